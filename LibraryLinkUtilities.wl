@@ -82,6 +82,18 @@ PacletFunctionLoad::usage = "PacletFunctionLoad[fname_?StringQ, fParams_, retTyp
 	a library name can be specified as the first argument. Unlike PacletFunctionSet, there is no mechanism
 	by which to avoid eager loading of the default paclet library.";
 
+TypedFunctionSet::usage = "TypedFunctionSet[resultSymbol_, opts___]
+	Loads a library function defined with LLU_TYPED_FUNCTION and assigns it to resultSymbol. Parameter and result types are taken from the library,
+	so they are not given explicitly. The library and function names can be given just like for PacletFunctionSet.";
+LazyTypedFunctionSet::usage = "LazyTypedFunctionSet[resultSymbol_, opts___]
+	Lazy version of TypedFunctionSet which loads the function upon the first evaluation of resultSymbol.";
+
+TypedFunctionLoad::usage = "TypedFunctionLoad[fname_?StringQ, opts___]
+	Loads a library function defined with LLU_TYPED_FUNCTION, with parameter and result types taken from the library.
+	A library name can be specified as the first argument.
+	With \"Listable\" -> True, a function defined with LLU_LISTABLE_TYPED_FUNCTION accepts lists or NumericArrays of arguments and evaluates
+	the C++ function for all of them in a single library call, on up to \"ThreadCount\" threads (0 means all available cores).";
+
 (* ---------------- Managed Library Expressions ---------------------------- *)
 
 Constructor::usage = "Constructor[exprHead_] shall evaluate to a function that takes an instanceID (Integer) and an arbitrary number of additional arguments.
@@ -458,6 +470,85 @@ Module[{errorHandler, pmSymbol, newParams, functionOptions, loadOptions},
 	]
 ];
 
+(* Functions defined with LLU_TYPED_FUNCTION come with a companion library function that returns their signature as a string {{paramTypes...}, retType} *)
+Options[TypedFunctionLoad] = Join[Options[PacletFunctionLoad], {"Listable" -> False, "ThreadCount" -> 1}];
+
+TypedFunctionLoad[fname_?StringQ, opts : OptionsPattern[]] :=
+	TypedFunctionLoad[$PacletLibrary, fname, opts];
+
+TypedFunctionLoad[libName_?StringQ, fname_?StringQ, opts : OptionsPattern[]] :=
+	Replace[
+		SafeLibraryFunctionLoad[libName, fname <> "_LLUSignature", {}, String, FilterRules[{opts}, Options[SafeLibraryFunctionLoad]]],
+		f_LibraryFunction :> Replace[ToExpression[f[]], {
+			{params : {$listableType...}, retType : $listableType | "Void"} /; TrueQ[OptionValue[TypedFunctionLoad, {opts}, "Listable"]] :>
+				listableFunctionLoad[libName, fname, params, retType, OptionValue[TypedFunctionLoad, {opts}, "ThreadCount"], opts],
+			{_List, _} /; TrueQ[OptionValue[TypedFunctionLoad, {opts}, "Listable"]] :> ThrowPacletFailure[
+				"FunctionLoadFailure",
+				"MessageParameters" -> <|"FunctionName" -> fname, "LibraryName" -> libName, "Details" -> "Only functions with scalar parameters and result can be listable."|>
+			],
+			{params_List, retType_} :> PacletFunctionLoad[libName, fname, params, retType, opts],
+			_ :> ThrowPacletFailure[
+				"FunctionLoadFailure",
+				"MessageParameters" -> <|"FunctionName" -> fname, "LibraryName" -> libName, "Details" -> "Invalid signature of a typed function."|>
+			]
+		}]
+	];
+
+(* The listable version of a typed function (defined with LLU_LISTABLE_TYPED_FUNCTION) is the companion library function fname_LLUListable, which takes
+ * every parameter as a list (Booleans as 0 and 1) followed by the number of threads to use, and returns a list of results. Scalar arguments are passed
+ * as lists of length 1, which are used in every row. If any argument is a NumericArray, all arguments are passed as NumericArrays to fname_LLUListableNumericArray
+ * instead, which returns a NumericArray of results (or a list of Booleans). *)
+$listableType = Integer | Real | Complex | "Boolean";
+
+listableFunctionLoad[libName_, fname_, params_, retType_, threadCount_Integer?NonNegative, opts___] :=
+	With[
+		{
+			lf = PacletFunctionLoad[
+				libName,
+				fname <> "_LLUListable",
+				Append[Replace[params, {"Boolean" -> {Integer, 1, "Constant"}, t_ :> {t, 1, "Constant"}}, {1}], Integer],
+				Replace[retType, {"Boolean" -> {Integer, 1}, "Void" -> "Void", t_ :> {t, 1}}],
+				opts
+			],
+			naf = PacletFunctionLoad[
+				libName,
+				fname <> "_LLUListableNumericArray",
+				Append[ConstantArray[{NumericArray, "Constant"}, Length[params]], Integer],
+				Replace[retType, {"Void" -> "Void", _ -> NumericArray}],
+				opts
+			]
+		},
+		listableCall[lf, naf, params, retType, threadCount, {##}]&
+	];
+
+listableFunctionLoad[libName_, fname_, __] :=
+	ThrowPacletFailure[
+		"FunctionLoadFailure",
+		"MessageParameters" -> <|"FunctionName" -> fname, "LibraryName" -> libName, "Details" -> "ThreadCount must be a non-negative integer."|>
+	];
+
+listableCall[lf_, naf_, params_, retType_, threadCount_, args_List] /; Length[args] === Length[params] :=
+	Module[{result},
+		result = If[AnyTrue[args, NumericArrayQ],
+			naf @@ Append[MapThread[toListableNumericArray, {params, args}], threadCount],
+			lf @@ Append[MapThread[toListableArgument, {params, args}], threadCount]
+		];
+		If[FailureQ[result] || retType === "Void",
+			result
+			,
+			If[retType === "Boolean", result = Replace[Normal[result], {0 -> False, _Integer -> True}, {1}]];
+			(* like built-in listable functions, return a single result when all arguments are scalars *)
+			If[NoneTrue[args, ListQ[#] || NumericArrayQ[#]&], First[result], result]
+		]
+	];
+
+toListableArgument["Boolean", arg_] := Developer`ToPackedArray[Boole[If[ListQ[arg], arg, {arg}]]];
+toListableArgument[_, arg_] := Developer`ToPackedArray[If[ListQ[arg], arg, {arg}]];
+
+toListableNumericArray[_, arg_?NumericArrayQ] := arg;
+toListableNumericArray[param_, arg_] :=
+	NumericArray[toListableArgument[param, arg], Replace[param, {Integer | "Boolean" -> "Integer64", Real -> "Real64", Complex -> "ComplexReal64"}]];
+
 MemberFunctionLoad[exprHead_][libName_, fname_String, fParams_, retType : Except[_?OptionQ], opts : OptionsPattern[PacletFunctionLoad]] :=
 	Block[{params = fParams},
 		If[params =!= LinkObject, PrependTo[params, Managed[exprHead]]];
@@ -535,6 +626,27 @@ PacletFunctionSet[symbol_, paramTypes_, retType : Except[_?OptionQ], opts : Opti
 LazyPacletFunctionSet[symbol_, paramTypes_, retType : Except[_?OptionQ], opts : OptionsPattern[]] :=
 	LazyPacletFunctionSet[symbol, guessFunctionNameFromSymbol[symbol], paramTypes, retType, opts];
 
+Options[TypedFunctionSet] = Options[TypedFunctionLoad];
+Options[LazyTypedFunctionSet] = Options[TypedFunctionSet];
+
+(* TypedFunctionSet[resultSymbol_, lib_, f_, opts___] - loads a function defined with LLU_TYPED_FUNCTION, which knows its own signature. *)
+Attributes[TypedFunctionSet] = {HoldFirst};
+Attributes[LazyTypedFunctionSet] = Attributes[TypedFunctionSet];
+TypedFunctionSet[symbol_, libraryName_, funcNameInLib_?StringQ, opts : OptionsPattern[]] :=
+	iLoadLibraryFunction[symbol, Set, TypedFunctionLoad, libraryName, funcNameInLib, opts];
+LazyTypedFunctionSet[symbol_, libraryName_, funcNameInLib_?StringQ, opts : OptionsPattern[]] :=
+	iLoadLibraryFunction[symbol, LazyLoad, TypedFunctionLoad, libraryName, funcNameInLib, opts];
+
+TypedFunctionSet[symbol_, funcNameInLib_?StringQ, opts : OptionsPattern[]] :=
+	TypedFunctionSet[symbol, $PacletLibrary, funcNameInLib, opts];
+LazyTypedFunctionSet[symbol_, funcNameInLib_?StringQ, opts : OptionsPattern[]] :=
+	LazyTypedFunctionSet[symbol, None, funcNameInLib, opts];
+
+TypedFunctionSet[symbol_, opts : OptionsPattern[]] :=
+	TypedFunctionSet[symbol, guessFunctionNameFromSymbol[symbol], opts];
+LazyTypedFunctionSet[symbol_, opts : OptionsPattern[]] :=
+	LazyTypedFunctionSet[symbol, guessFunctionNameFromSymbol[symbol], opts];
+
 Options[WSTPFunctionSet] = Options[PacletFunctionSet];
 Options[LazyWSTPFunctionSet] = Options[WSTPFunctionSet];
 
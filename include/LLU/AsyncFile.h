@@ -0,0 +1,166 @@
+/**
+ * @file	AsyncFile.h
+ * @date	October 19, 2026
+ * @brief	Definition of AsyncFile, a file with asynchronous positioned reads and writes.
+ */
+#ifndef LLU_ASYNCFILE_H
+#define LLU_ASYNCFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <ios>
+#include <memory>
+#include <span>
+#include <string>
+
+#include "LLU/Containers/NumericArray.h"
+
+namespace LLU {
+
+	/// Mechanism used by AsyncFile to perform I/O
+	enum class AsyncBackend {
+		Auto,		///< io_uring when supported by the system, ThreadPool otherwise
+		IoUring,	///< Linux io_uring, falls back to ThreadPool when not supported by the kernel
+		ThreadPool	///< Blocking positioned reads and writes on a pool of background threads
+	};
+
+	/**
+	 * @class   AsyncFile
+	 * @brief   A file in which many reads and writes at given offsets can be in flight at the same time.
+	 * @details Requests are queued by readAt() and writeAt() and sent to the system in batches, either when the queue is full or when submit(),
+	 *          poll() or wait() is called. Completion callbacks are always called on the thread that owns the AsyncFile, from within one of its
+	 *          member functions, so they may use the LibraryLink API. Buffers passed to readAt() and writeAt() must stay alive and must not be
+	 *          accessed until the request completes.
+	 *
+	 *          On Linux the requests are handled by io_uring. When io_uring is not available, and on other platforms, blocking positioned I/O is
+	 *          performed on a small pool of background threads.
+	 */
+	class AsyncFile {
+	public:
+		/// Callback called with the number of bytes transferred, which is smaller than requested only when a read reaches the end of the file
+		using Completion = std::function<void(std::size_t)>;
+
+		/// Default maximal number of requests in flight
+		static constexpr unsigned DefaultQueueDepth = 64;
+
+		/**
+		 * @brief   Open a file for asynchronous I/O.
+		 * @param   fileName - path to the file, it is validated with validatePath() first
+		 * @param   mode - open mode, std::ios::in to read, std::ios::out to write (the file is created if it does not exist), std::ios::trunc to
+		 *          discard the previous contents
+		 * @param   queueDepth - maximal number of requests in flight, further requests wait in a queue
+		 * @param   backend - preferred I/O mechanism
+		 * @throws  ErrorName::InvalidOpenMode - if \p mode contains neither std::ios::in nor std::ios::out
+		 * @throws  ErrorName::OpenFileFailed - if the file could not be opened
+		 */
+		AsyncFile(const std::string& fileName, std::ios::openmode mode, unsigned queueDepth = DefaultQueueDepth, AsyncBackend backend = AsyncBackend::Auto);
+
+		AsyncFile(const AsyncFile&) = delete;
+		AsyncFile& operator=(const AsyncFile&) = delete;
+		AsyncFile(AsyncFile&&) = delete;
+		AsyncFile& operator=(AsyncFile&&) = delete;
+
+		/// Wait for requests in flight, without calling their completions, drop queued requests and close the file
+		~AsyncFile();
+
+		/**
+		 * @brief   Queue a read of \p buffer.size() bytes starting at \p offset.
+		 * @param   offset - position in the file
+		 * @param   buffer - memory to read into
+		 * @param   onDone - optional completion callback
+		 */
+		void readAt(std::uint64_t offset, std::span<std::byte> buffer, Completion onDone = {});
+
+		/**
+		 * @brief   Queue a read of the whole contents of a NumericArray, in the native byte order, starting at \p offset.
+		 * @param   offset - position in the file
+		 * @param   array - NumericArray to fill
+		 * @param   onDone - optional completion callback
+		 */
+		template<typename T>
+		void readAt(std::uint64_t offset, NumericArray<T>& array, Completion onDone = {}) {
+			readAt(offset, std::as_writable_bytes(std::span {array.data(), static_cast<std::size_t>(array.size())}), std::move(onDone));
+		}
+
+		/**
+		 * @brief   Queue a write of \p buffer starting at \p offset.
+		 * @param   offset - position in the file
+		 * @param   buffer - bytes to write
+		 * @param   onDone - optional completion callback
+		 */
+		void writeAt(std::uint64_t offset, std::span<const std::byte> buffer, Completion onDone = {});
+
+		/**
+		 * @brief   Queue a write of the whole contents of a NumericArray, in the native byte order, starting at \p offset.
+		 * @param   offset - position in the file
+		 * @param   array - NumericArray to write
+		 * @param   onDone - optional completion callback
+		 */
+		template<typename T>
+		void writeAt(std::uint64_t offset, const NumericArray<T>& array, Completion onDone = {}) {
+			writeAt(offset, std::as_bytes(std::span {array.data(), static_cast<std::size_t>(array.size())}), std::move(onDone));
+		}
+
+		/// Send all queued requests to the system, as far as the queue depth allows
+		void submit();
+
+		/**
+		 * @brief   Submit queued requests and call completions of the requests that have finished, without blocking.
+		 * @return  number of finished requests
+		 * @throws  ErrorName::FileReadFailed, ErrorName::FileWriteFailed - if any of the finished requests failed
+		 */
+		std::size_t poll();
+
+		/**
+		 * @brief   Submit queued requests and wait until all of them finish, calling their completions.
+		 * @throws  ErrorName::FileReadFailed, ErrorName::FileWriteFailed - if any of the requests failed, requests which have not finished yet
+		 *          stay pending and wait() may be called again
+		 */
+		void wait();
+
+		/// Get the number of requests which have not finished yet
+		[[nodiscard]] std::size_t pending() const noexcept {
+			return queued.size() + inFlight;
+		}
+
+		/// Get the I/O mechanism in use
+		[[nodiscard]] AsyncBackend backend() const noexcept {
+			return engineType;
+		}
+
+		/// A single read or write request
+		struct Request;
+
+		/// Interface of the I/O mechanisms
+		class Engine;
+
+	private:
+		void enqueue(std::unique_ptr<Request> request);
+
+		/// Collect finished requests and call their completions, throw if any of them failed
+		std::size_t complete(bool block);
+
+		/// Name of the file, for error messages
+		std::string fileName;
+
+		/// Maximal number of requests in flight
+		unsigned depth;
+
+		/// Requests waiting to be submitted
+		std::deque<std::unique_ptr<Request>> queued;
+
+		/// Number of submitted requests which have not been collected yet
+		std::size_t inFlight = 0;
+
+		/// I/O mechanism in use
+		AsyncBackend engineType = AsyncBackend::ThreadPool;
+
+		/// Implementation of the I/O mechanism, owns the file handle
+		std::unique_ptr<Engine> engine;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_ASYNCFILE_H
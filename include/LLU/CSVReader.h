@@ -0,0 +1,74 @@
+/**
+ * @file	CSVReader.h
+ * @date	October 19, 2026
+ * @brief	Parallel reader of delimited text files (CSV, TSV) producing typed DataVector columns.
+ */
+#ifndef LLU_CSVREADER_H
+#define LLU_CSVREADER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LLU/Containers/Generic/DataVector.hpp"
+
+namespace LLU::CSV {
+
+	/// Type of a column inferred from its values
+	enum class ColumnType {
+		Integer,	///< All values are integers, stored as Integer64
+		Real,		///< All values are numbers, stored as Real64
+		Boolean,	///< All values are True or False (in any letter case)
+		Date,		///< All values are dates in the ISO format YYYY-MM-DD, stored as days since 1970-01-01
+		String		///< Any other values
+	};
+
+	/// Options of the delimited text reader
+	struct Options {
+		/// Character separating fields in a record, e.g. ',' for CSV or '\\t' for TSV
+		char delimiter = ',';
+
+		/// Character used to quote fields which contain delimiters, new lines or quotes. Quotes inside quoted fields are written twice.
+		char quote = '"';
+
+		/// Whether the first record holds column names
+		bool header = true;
+
+		/// Maximal number of threads to use, 0 means the hardware concurrency
+		unsigned threadCount = 0;
+	};
+
+	/// Columns read from a delimited text file
+	struct Table {
+		/// Column names taken from the header, or empty strings if there is no header
+		std::vector<std::string> names;
+
+		/// Inferred type of each column
+		std::vector<ColumnType> types;
+
+		/// Values of each column, unquoted empty fields are missing and quoted empty fields ("") are empty strings
+		std::vector<DataVector> columns;
+	};
+
+	/**
+	 * @brief   Parse delimited text into typed columns.
+	 * @details The text is split into chunks at record boundaries and chunks are parsed in parallel. A column is given the most specific type that
+	 *          fits all of its non-missing fields, so a column with a quoted empty field is a String column. The number of columns is taken from the
+	 *          first record. Records with fewer fields get missing values in the remaining columns and extra fields are ignored. Line endings may be
+	 *          "\n" or "\r\n" and empty lines are skipped.
+	 * @param   text - contents of a delimited file
+	 * @param   options - reader options
+	 */
+	Table parse(std::string_view text, const Options& options = {});
+
+	/**
+	 * @brief   Read a delimited text file into typed columns. The file is memory-mapped, so it is not copied before parsing.
+	 * @param   fileName - path to the file, it is validated with validatePath()
+	 * @param   options - reader options
+	 * @throws  see MappedFile::MappedFile
+	 */
+	Table read(const std::string& fileName, const Options& options = {});
+
+}  // namespace LLU::CSV
+
+#endif	  // LLU_CSVREADER_H
@@ -0,0 +1,280 @@
+/**
+ * @file	ChunkReader.h
+ * @date	October 19, 2026
+ * @brief	Definition of readers that stream large files in fixed-size chunks with read-ahead on a background thread.
+ */
+#ifndef LLU_CHUNKREADER_H
+#define LLU_CHUNKREADER_H
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "LLU/Containers/Generic/DataVector.hpp"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/FileUtilities.h"
+
+namespace LLU {
+
+	/**
+	 * @class   ChunkReader
+	 * @brief   Reads a file in chunks of fixed size, with the next chunk being read on a background thread while the current one is processed.
+	 * @details Two buffers are allocated once and reused for the whole file, so memory usage is bounded by twice the chunk size.
+	 *          The file is opened with openFile(), so the path is validated first.
+	 */
+	class ChunkReader {
+	public:
+		/// Default size of a chunk in bytes
+		static constexpr std::size_t DefaultChunkSize = std::size_t {1} << 22U;
+
+		/**
+		 * @brief   Open a file and start reading the first chunk in the background.
+		 * @param   fileName - path to the file
+		 * @param   chunkSize - size of each chunk in bytes, only the last chunk may be shorter
+		 * @throws  see openFile()
+		 */
+		explicit ChunkReader(const std::string& fileName, std::size_t chunkSize = DefaultChunkSize);
+
+		/**
+		 * @brief   Open a file and start reading the first chunk in the background into buffers provided by the caller.
+		 * @param   fileName - path to the file
+		 * @param   first - first chunk buffer, its size is the chunk size
+		 * @param   second - second chunk buffer, must have the same size as \p first
+		 * @throws  see openFile()
+		 * @note    Both buffers must stay valid until the ChunkReader is destroyed or they are replaced with replaceCurrentBuffer().
+		 */
+		ChunkReader(const std::string& fileName, std::span<char> first, std::span<char> second);
+
+		ChunkReader(const ChunkReader&) = delete;
+		ChunkReader& operator=(const ChunkReader&) = delete;
+		ChunkReader(ChunkReader&&) = delete;
+		ChunkReader& operator=(ChunkReader&&) = delete;
+
+		/// Stop reading ahead and close the file
+		~ChunkReader();
+
+		/**
+		 * @brief   Get the next chunk of the file. The chunk remains valid until the next call.
+		 * @return  bytes of the next chunk, or an empty span when the whole file has been read
+		 * @throws  ErrorName::FileReadFailed - if reading from the file failed
+		 */
+		std::span<const char> next();
+
+		/**
+		 * @brief   Replace the buffer returned by the most recent call to next() with another buffer of the chunk size, which will be used to read
+		 *          subsequent chunks. The replaced buffer is no longer used by the ChunkReader, so the caller may keep its contents.
+		 * @param   buffer - new buffer, must stay valid until the ChunkReader is destroyed or the buffer is replaced
+		 */
+		void replaceCurrentBuffer(std::span<char> buffer);
+
+		/// Get the size of chunks in bytes
+		[[nodiscard]] std::size_t chunkSize() const noexcept {
+			return chunkLength;
+		}
+
+	private:
+		/// Body of the background thread, fills free buffers until the end of file
+		void readAhead(const std::stop_token& stop);
+
+		/// Start reading ahead on the background thread
+		void start();
+
+		/// Name of the file, for error messages
+		std::string fileName;
+
+		/// The file being read
+		FilePtr file;
+
+		/// Size of chunks in bytes
+		std::size_t chunkLength;
+
+		/// Memory of chunk buffers if they were not provided by the caller
+		std::array<std::vector<char>, 2> storage;
+
+		/// Chunk buffers, used alternately by the background thread and by the caller
+		std::array<std::span<char>, 2> buffers;
+
+		/// Number of bytes read into each buffer
+		std::array<std::size_t, 2> filled {};
+
+		/// Index of the buffer returned by the most recent call to next()
+		std::size_t current = 1;
+
+		/// Number of buffers filled by the background thread and not yet returned by next()
+		std::size_t ready = 0;
+
+		/// Whether the caller holds the buffer returned by the most recent call to next()
+		bool held = false;
+
+		/// Whether the background thread has finished reading
+		bool finished = false;
+
+		/// Whether reading from the file failed
+		bool readFailed = false;
+
+		/// Synchronization between the background thread and the caller
+		std::mutex mutex;
+		std::condition_variable_any bufferStateChanged;
+
+		/// Background thread, declared last so that it is stopped before other members are destroyed
+		std::jthread worker;
+	};
+
+	/**
+	 * @class   NumericArrayChunkReader
+	 * @brief   Reads a binary file of elements of type T, in the native byte order, as a sequence of NumericArrays of fixed length.
+	 * @tparam  T - type of elements, must be one of the NumericArray data types
+	 */
+	template<typename T>
+	class NumericArrayChunkReader {
+	public:
+		/**
+		 * @brief   Open a binary file for reading in chunks.
+		 * @param   fileName - path to the file
+		 * @param   elementsPerChunk - number of elements in each chunk, only the last chunk may be shorter
+		 * @throws  see openFile()
+		 */
+		NumericArrayChunkReader(const std::string& fileName, mint elementsPerChunk)
+			: chunkLength {std::max(elementsPerChunk, mint {1})}, arrays {newChunk(), newChunk()}, reader {fileName, bytesOf(arrays[0]), bytesOf(arrays[1])},
+			  path {fileName} {}
+
+		/**
+		 * @brief   Read the next chunk into a NumericArray.
+		 * @details Chunks are read directly into NumericArrays, which are exchanged with \p chunk, so no data is copied except for the last chunk
+		 *          if it is shorter. The previous contents of \p chunk is reused to read subsequent chunks if its length matches the chunk length.
+		 * @param   chunk - NumericArray to fill
+		 * @return  false if the whole file has been read, in which case \p chunk is not modified
+		 * @throws  ErrorName::FileReadFailed - if reading failed or the file ends in the middle of an element
+		 */
+		bool read(NumericArray<T>& chunk) {
+			const auto bytes = reader.next();
+			if (bytes.empty()) {
+				return false;
+			}
+			if (bytes.size() % sizeof(T) != 0) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::FileReadFailed, "File ends in the middle of an element", path);
+			}
+			const auto count = static_cast<mint>(bytes.size() / sizeof(T));
+			const auto index = (bytes.data() == bytesOf(arrays[0]).data()) ? 0 : 1;
+			if (count != chunkLength) {
+				// only the last chunk may be shorter
+				chunk = NumericArray<T> {T {}, MArrayDimensions {count}};
+				std::memcpy(chunk.data(), bytes.data(), bytes.size());
+				return true;
+			}
+			if (!chunk.getContainer() || chunk.getFlattenedLength() != chunkLength) {
+				chunk = newChunk();
+			}
+			std::swap(chunk, arrays[index]);
+			reader.replaceCurrentBuffer(bytesOf(arrays[index]));
+			return true;
+		}
+
+		/**
+		 * @brief   Call \p f for each chunk of the file, in order. A single NumericArray is reused for all chunks of equal length.
+		 * @param   f - callable taking const NumericArray<T>&, the array must not be used after \p f returns
+		 */
+		template<typename F>
+		void forEachChunk(F&& f) {
+			NumericArray<T> chunk;
+			while (read(chunk)) {
+				f(static_cast<const NumericArray<T>&>(chunk));
+			}
+		}
+
+	private:
+		NumericArray<T> newChunk() const {
+			return NumericArray<T> {T {}, MArrayDimensions {chunkLength}};
+		}
+
+		static std::span<char> bytesOf(NumericArray<T>& array) {
+			return {reinterpret_cast<char*>(array.data()), static_cast<std::size_t>(array.getFlattenedLength()) * sizeof(T)};
+		}
+
+		/// Number of elements in each chunk
+		mint chunkLength;
+
+		/// NumericArrays that the ChunkReader reads into, they must outlive the reader
+		std::array<NumericArray<T>, 2> arrays;
+
+		ChunkReader reader;
+
+		/// Path to the file, for error messages
+		std::string path;
+	};
+
+	/**
+	 * @class   DelimitedChunkReader
+	 * @brief   Reads a delimited text file (e.g. CSV or TSV without quoted fields) as a sequence of chunks of whole records.
+	 * @details Each chunk can be obtained either as raw text or split into String DataVectors, one per column. The number of columns is taken
+	 *          from the first record. Empty fields and fields missing at the end of a record become missing elements, extra fields are ignored.
+	 *          Line endings may be "\n" or "\r\n" and empty lines are skipped.
+	 */
+	class DelimitedChunkReader {
+	public:
+		/**
+		 * @brief   Open a delimited text file for reading in chunks.
+		 * @param   fileName - path to the file
+		 * @param   delimiter - character separating fields in a record
+		 * @param   chunkSize - approximate size of each chunk in bytes, chunks are extended or shortened to end at a record boundary
+		 * @throws  see openFile()
+		 */
+		explicit DelimitedChunkReader(const std::string& fileName, char delimiter = ',', std::size_t chunkSize = ChunkReader::DefaultChunkSize);
+
+		/**
+		 * @brief   Get the text of the next chunk of whole records. The text remains valid until the next call.
+		 * @return  text of the records, or an empty string_view when the whole file has been read
+		 * @throws  ErrorName::FileReadFailed - if reading from the file failed
+		 */
+		std::string_view nextRecords();
+
+		/**
+		 * @brief   Read the next chunk of records and split it into columns.
+		 * @param   columns - vector to be filled with one String DataVector per column
+		 * @return  false if the whole file has been read, in which case \p columns is not modified
+		 * @throws  ErrorName::FileReadFailed - if reading from the file failed
+		 */
+		bool read(std::vector<DataVector>& columns);
+
+		/**
+		 * @brief   Call \p f for each chunk of the file, in order.
+		 * @param   f - callable taking std::vector<DataVector>&, one String DataVector per column
+		 */
+		template<typename F>
+		void forEachChunk(F&& f) {
+			std::vector<DataVector> columns;
+			while (read(columns)) {
+				f(columns);
+			}
+		}
+
+		/// Get the number of columns, or 0 if no record has been read yet
+		[[nodiscard]] std::size_t columnCount() const noexcept {
+			return columnTotal;
+		}
+
+	private:
+		ChunkReader reader;
+		char delimiter;
+
+		/// Records returned by the most recent call to nextRecords()
+		std::string records;
+
+		/// Incomplete record at the end of the most recent chunk
+		std::string carry;
+
+		/// Number of columns, determined from the first record
+		std::size_t columnTotal = 0;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CHUNKREADER_H
@@ -0,0 +1,105 @@
+/**
+ * @file	Compression.h
+ * @date	October 19, 2026
+ * @brief	Compression of NumericArray data.
+ */
+#ifndef LLU_COMPRESSION_H
+#define LLU_COMPRESSION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/Views/NumericArray.hpp"
+
+namespace LLU::NA {
+
+	/// Compression algorithm applied to NumericArray data
+	enum class Codec : std::uint8_t {
+		None = 0,	 ///< Data is stored uncompressed
+		LZ4 = 1		 ///< LZ4 block format, fast to compress and very fast to decompress
+	};
+
+	/// Transformation of the data applied before compression, which groups together the bytes (or bits) that tend to be similar
+	enum class Filter : std::uint8_t {
+		None = 0,		   ///< Data is compressed as is
+		Shuffle = 1,	   ///< Byte i of every element is stored before byte i + 1 of any element
+		BitShuffle = 2,	   ///< Bit i of every element is stored before bit i + 1 of any element
+		Auto = 0xFF		   ///< BitShuffle for single-byte elements and Shuffle for larger ones
+	};
+
+	/// Parameters of NumericArray compression
+	struct CompressionOptions {
+		/// Compression algorithm
+		Codec codec = Codec::LZ4;
+
+		/// Compression level from 1 (fastest) to 9 (best compression), other values are clamped
+		int level = 1;
+
+		/// Filter applied to each block before compression
+		Filter filter = Filter::Auto;
+
+		/// Number of bytes of the array compressed independently, rounded down to a multiple of 8 elements
+		std::size_t blockSize = std::size_t {1} << 20;
+
+		/// Maximal number of threads used to compress the blocks, 0 means the hardware concurrency
+		unsigned threadCount = 0;
+	};
+
+	/**
+	 * @brief   Compress the data of a NumericArray.
+	 * @details The array is split into blocks which are compressed in parallel on a thread pool. The result holds the type and dimensions of the
+	 *          array, followed by the sizes of compressed blocks and the blocks themselves, so it can be decompressed by decompress() alone.
+	 *          Blocks which do not compress are stored unchanged. Element bytes are stored in the native byte order.
+	 * @param   array - NumericArray to compress
+	 * @param   options - compression parameters
+	 * @return  compressed data
+	 */
+	UInt8Array compress(const NumericArrayView& array, const CompressionOptions& options = {});
+
+	/**
+	 * @brief   Compress the data of a NumericArray with default options and given codec and level.
+	 * @param   array - NumericArray to compress
+	 * @param   codec - compression algorithm
+	 * @param   level - compression level from 1 (fastest) to 9 (best compression)
+	 * @return  compressed data
+	 */
+	inline UInt8Array compress(const NumericArrayView& array, Codec codec, int level = 1) {
+		return compress(array, CompressionOptions {.codec = codec, .level = level});
+	}
+
+	/**
+	 * @brief   Decompress data returned by compress() into a new NumericArray of the original type and dimensions.
+	 * @param   data - compressed data
+	 * @param   threadCount - maximal number of threads used to decompress the blocks, 0 means the hardware concurrency
+	 * @return  new NumericArray owned by the library
+	 * @throws  ErrorName::NumericArrayDecompressionError - if \p data is not a valid result of compress()
+	 */
+	GenericNumericArray decompress(std::span<const std::uint8_t> data, unsigned threadCount = 0);
+
+	/**
+	 * @brief   Decompress data returned by compress() into a new NumericArray<T>.
+	 * @tparam  T - type of the elements of the compressed array
+	 * @param   data - compressed data
+	 * @param   threadCount - maximal number of threads used to decompress the blocks, 0 means the hardware concurrency
+	 * @throws  ErrorName::NumericArrayDecompressionError - if \p data is not a valid result of compress()
+	 * @throws  ErrorName::NumericArrayTypeError - if the compressed array has elements of a different type
+	 */
+	template<typename T>
+	NumericArray<T> decompress(std::span<const std::uint8_t> data, unsigned threadCount = 0) {
+		return NumericArray<T> {decompress(data, threadCount)};
+	}
+
+	namespace Detail {
+		/// Compress raw bytes into a single LZ4 block, \p level is clamped to the range from 1 to 9
+		std::vector<std::uint8_t> compressLZ4Block(std::span<const std::uint8_t> input, int level);
+
+		/// Decompress an LZ4 block which must expand to exactly output.size() bytes, return false if the block is malformed
+		bool decompressLZ4Block(std::span<const std::uint8_t> input, std::span<std::uint8_t> output) noexcept;
+	}  // namespace Detail
+
+}  // namespace LLU::NA
+
+#endif	  // LLU_COMPRESSION_H
@@ -9,11 +9,13 @@
 #define LLU_CONTAINERS_DATALIST_H
 
 #include <initializer_list>
+#include <ranges>
 #include <string>
 #include <string_view>
 #include <utility>
 #include <vector>
 
+#include "LLU/Containers/DataListIndex.h"
 #include "LLU/Containers/Generic/DataStore.hpp"
 #include "LLU/Containers/Iterators/DataList.hpp"
 #include "LLU/ErrorLog/ErrorManager.h"
@@ -68,10 +70,29 @@ namespace LLU {
 
 		/**
 		 * @brief	Create DataList from list of keys and corresponding values.
-		 * @param 	initList - list of pairs key - value to put in the DataList
+		 * @param 	initList - list of pairs key - value to put in the DataList, keys must be null-terminated
 		 * @note    This constructor can only be used if value_type is copyable.
 		 */
-		DataList(std::initializer_list<std::pair<std::string, value_type>> initList);
+		DataList(std::initializer_list<std::pair<std::string_view, value_type>> initList);
+
+		/**
+		 * @brief	Create DataList from a range of values. Keys will be set to empty strings.
+		 * @tparam  R - input range with elements convertible to value_type
+		 * @param 	values - range of values to put in the DataList, containers in the range will be owned by the DataList
+		 */
+		template<std::ranges::input_range R>
+			requires(!std::is_base_of_v<GenericDataList, std::remove_cvref_t<R>>)
+		explicit DataList(R&& values);
+
+		/**
+		 * @brief	Create DataList from a range of keys and a range of corresponding values.
+		 * @tparam  N - input range with elements convertible to std::string_view
+		 * @tparam  R - input range with elements convertible to value_type
+		 * @param 	names - range of keys, each must point to a null-terminated string
+		 * @param 	values - range of values to put in the DataList, containers in the range will be owned by the DataList
+		 */
+		template<std::ranges::input_range N, std::ranges::input_range R>
+		DataList(N&& names, R&& values);
 
 		/**
 		 * @brief   Clone this DataList, performing a deep copy of the underlying DataStore.
@@ -149,6 +170,25 @@ namespace LLU {
 		 */
 		void push_back(std::string_view name, value_type nodeData);
 
+		/**
+		 * @brief 	Add new nodes to the DataList, one for each element of given range.
+		 * @tparam  R - input range with elements convertible to value_type
+		 * @param 	values - range of values to be appended, containers in the range will be owned by the DataList
+		 * @note    Contiguous ranges of mint, mreal or mcomplex are appended without any per-node conversions, see GenericDataList::append_range.
+		 */
+		template<std::ranges::input_range R>
+		void append_range(R&& values);
+
+		/**
+		 * @brief 	Add new named nodes to the DataList, one for each element of given range.
+		 * @tparam  N - input range with elements convertible to std::string_view
+		 * @tparam  R - input range with elements convertible to value_type
+		 * @param 	names - range of names for new nodes, each must point to a null-terminated string
+		 * @param 	values - range of values to be appended, containers in the range will be owned by the DataList
+		 */
+		template<std::ranges::input_range N, std::ranges::input_range R>
+		void append_range(N&& names, R&& values);
+
 		/**
 		 * @brief   Return a vector of DataList node values.
 		 * @return  a std::vector of node values
@@ -165,6 +205,15 @@ namespace LLU {
 			return {nameBegin(), nameEnd()};
 		}
 
+		/**
+		 * @brief   Build a random-access index over the nodes of this DataList.
+		 * @return  DataListIndex which provides constant-time access to nodes by position and hash-based lookup by name
+		 * @note    The index must not outlive this DataList and it does not see nodes added after it was built.
+		 */
+		DataListIndex<T> index() const {
+			return DataListIndex<T> {*this};
+		}
+
 		/**
 		 * @brief   Return a vector of DataList nodes.
 		 * @return  a std::vector of nodes in the form of DataNode<T> objects
@@ -189,15 +238,62 @@ namespace LLU {
 
 	template<typename T>
 	DataList<T>::DataList(std::initializer_list<value_type> initList) : DataList() {
-		for (auto&& elem : initList) {
-			push_back(std::move(elem));
+		append_range(initList);
+	}
+
+	template<typename T>
+	DataList<T>::DataList(std::initializer_list<std::pair<std::string_view, value_type>> initList) : DataList() {
+		for (const auto& elem : initList) {
+			push_back(elem.first, elem.second);
+		}
+	}
+
+	template<typename T>
+	template<std::ranges::input_range R>
+		requires(!std::is_base_of_v<GenericDataList, std::remove_cvref_t<R>>)
+	DataList<T>::DataList(R&& values) : DataList() {
+		append_range(std::forward<R>(values));
+	}
+
+	template<typename T>
+	template<std::ranges::input_range N, std::ranges::input_range R>
+	DataList<T>::DataList(N&& names, R&& values) : DataList() {
+		append_range(std::forward<N>(names), std::forward<R>(values));
+	}
+
+	template<typename T>
+	template<std::ranges::input_range R>
+	void DataList<T>::append_range(R&& values) {
+		using ElemType = std::ranges::range_value_t<R>;
+		static_assert(std::is_convertible_v<ElemType, value_type>, "DataList::append_range: range elements are not convertible to the node type.");
+		if constexpr (std::is_same_v<value_type, NodeType::Any> || Detail::dataStoreNodeType<ElemType>() == Argument::WrapperIndex<value_type>) {
+			GenericDataList::append_range(std::forward<R>(values));
+		} else {
+			for (auto&& v : values) {
+				push_back(static_cast<value_type>(v));
+			}
 		}
 	}
 
 	template<typename T>
-	DataList<T>::DataList(std::initializer_list<std::pair<std::string, value_type>> initList) : DataList() {
-		for (auto&& elem : initList) {
-			push_back(elem.first, std::move(elem.second));
+	template<std::ranges::input_range N, std::ranges::input_range R>
+	void DataList<T>::append_range(N&& names, R&& values) {
+		using ElemType = std::ranges::range_value_t<R>;
+		static_assert(std::is_convertible_v<ElemType, value_type>, "DataList::append_range: range elements are not convertible to the node type.");
+		if constexpr (std::is_same_v<value_type, NodeType::Any> || Detail::dataStoreNodeType<ElemType>() == Argument::WrapperIndex<value_type>) {
+			GenericDataList::append_range(std::forward<N>(names), std::forward<R>(values));
+		} else {
+			if constexpr (std::ranges::sized_range<N> && std::ranges::sized_range<R>) {
+				if (std::ranges::size(names) != std::ranges::size(values)) {
+					ErrorManager::throwException(ErrorName::DLRangeSizeMismatch, static_cast<mint>(std::ranges::size(names)),
+														  static_cast<mint>(std::ranges::size(values)));
+				}
+			}
+			auto nameIt = std::ranges::begin(names);
+			for (auto&& v : values) {
+				push_back(std::string_view {*nameIt}, static_cast<value_type>(v));
+				++nameIt;
+			}
 		}
 	}
 
@@ -0,0 +1,194 @@
+/**
+ * @file	DataListIndex.h
+ * @date	October 19, 2026
+ * @brief	Definition of DataListIndex - a random-access side index over a DataStore.
+ */
+#ifndef LLU_CONTAINERS_DATALISTINDEX_H
+#define LLU_CONTAINERS_DATALISTINDEX_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "LLU/Containers/Generic/DataStore.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/TypedMArgument.h"
+
+namespace LLU {
+
+	/**
+	 * @class   DataListIndex
+	 * @brief   Random-access view over the nodes of a DataStore.
+	 * @details DataStore is a singly linked list so reaching a node by position or by name requires walking the list. DataListIndex walks the list
+	 *          once, when it is created, and afterwards provides constant-time access to nodes by position and hash-based lookup by name.
+	 *          The index does not own the DataStore, so it must not outlive the DataList it was created from. Nodes appended to the DataList after
+	 *          the index was built are not visible through the index.
+	 * @tparam  T - default type of node values, see the \c NodeType namespace for possible node types
+	 */
+	template<typename T = Argument::Typed::Any>
+	class DataListIndex {
+		static_assert(Argument::WrapperQ<T>, "DataListIndex type is not a valid MArgument wrapper type.");
+
+	public:
+		/// Value of a node is of type T
+		using value_type = T;
+
+		/**
+		 * @brief   Build an index of all nodes in given DataList
+		 * @param   dl - a DataList or GenericDataList to be indexed
+		 */
+		explicit DataListIndex(const GenericDataList& dl);
+
+		/**
+		 * @brief   Get the number of indexed nodes
+		 */
+		[[nodiscard]] mint size() const noexcept {
+			return static_cast<mint>(nodes.size());
+		}
+
+		/**
+		 * @brief   Get the value of the node at given position. The index is not checked.
+		 * @param   index - position of the node in the DataList
+		 * @return  value of the node
+		 */
+		value_type operator[](mint index) const {
+			return node(index).template as<value_type>();
+		}
+
+		/**
+		 * @brief   Get the value of the node at given position.
+		 * @param   index - position of the node in the DataList
+		 * @return  value of the node
+		 * @throws  ErrorName::DLIndexError - if \p index is out of range
+		 */
+		value_type at(mint index) const {
+			return checkedNode(index).template as<value_type>();
+		}
+
+		/**
+		 * @brief   Get the value of the node with given name.
+		 * @param   name - name of the node, if multiple nodes share the same name the first one is used
+		 * @return  value of the node
+		 * @throws  ErrorName::DLNameNotFound - if there is no node named \p name
+		 */
+		value_type at(std::string_view name) const {
+			return checkedNode(name).template as<value_type>();
+		}
+
+		/**
+		 * @brief   Get the value of the node at given position as a value of type U, without constructing the TypedArgument variant.
+		 * @tparam  U - any type from LLU::NodeType namespace
+		 * @param   index - position of the node in the DataList
+		 * @return  value of the node
+		 * @throws  ErrorName::DLIndexError - if \p index is out of range
+		 * @throws  ErrorName::DLInvalidNodeType - if the node value is not of type U
+		 */
+		template<typename U>
+		U as(mint index) const {
+			return checkedNode(index).template as<U>();
+		}
+
+		/**
+		 * @brief   Get the value of the node with given name as a value of type U, without constructing the TypedArgument variant.
+		 * @tparam  U - any type from LLU::NodeType namespace
+		 * @param   name - name of the node, if multiple nodes share the same name the first one is used
+		 * @return  value of the node
+		 * @throws  ErrorName::DLNameNotFound - if there is no node named \p name
+		 * @throws  ErrorName::DLInvalidNodeType - if the node value is not of type U
+		 */
+		template<typename U>
+		U as(std::string_view name) const {
+			return checkedNode(name).template as<U>();
+		}
+
+		/**
+		 * @brief   Get the node at given position. The index is not checked.
+		 * @param   index - position of the node in the DataList
+		 * @return  GenericDataNode wrapper of the node
+		 */
+		[[nodiscard]] GenericDataNode node(mint index) const noexcept {
+			return {nodes[static_cast<std::size_t>(index)]};
+		}
+
+		/**
+		 * @brief   Find the first node with given name.
+		 * @param   name - name of the node
+		 * @return  GenericDataNode wrapper of the node or a null node if there is no node named \p name
+		 */
+		[[nodiscard]] GenericDataNode find(std::string_view name) const {
+			auto pos = positions.find(name);
+			return pos == positions.end() ? GenericDataNode {nullptr} : node(pos->second);
+		}
+
+		/**
+		 * @brief   Get the position of the first node with given name.
+		 * @param   name - name of the node
+		 * @return  position of the node or -1 if there is no node named \p name
+		 */
+		[[nodiscard]] mint position(std::string_view name) const {
+			auto pos = positions.find(name);
+			return pos == positions.end() ? -1 : pos->second;
+		}
+
+		/**
+		 * @brief   Check if there is a node with given name.
+		 * @param   name - name of the node
+		 */
+		[[nodiscard]] bool contains(std::string_view name) const {
+			return positions.find(name) != positions.end();
+		}
+
+		/**
+		 * @brief   Get the name of the node at given position. The index is not checked.
+		 * @param   index - position of the node in the DataList
+		 * @return  string_view to the node name, valid as long as the underlying DataStore
+		 */
+		[[nodiscard]] std::string_view name(mint index) const noexcept {
+			return node(index).name();
+		}
+
+	private:
+		GenericDataNode checkedNode(mint index) const {
+			if (index < 0 || index >= size()) {
+				ErrorManager::throwException(ErrorName::DLIndexError, index, size());
+			}
+			return node(index);
+		}
+
+		GenericDataNode checkedNode(std::string_view name) const {
+			auto pos = positions.find(name);
+			if (pos == positions.end()) {
+				ErrorManager::throwException(ErrorName::DLNameNotFound, std::string {name});
+			}
+			return node(pos->second);
+		}
+
+		/// Raw nodes in the order in which they appear in the DataStore
+		std::vector<DataStoreNode> nodes;
+
+		/// Maps node names to positions of the first node with that name. Keys point to names owned by the DataStore.
+		std::unordered_map<std::string_view, mint> positions;
+	};
+
+	template<typename T>
+	DataListIndex<T>::DataListIndex(const GenericDataList& dl) {
+		const auto len = static_cast<std::size_t>(dl.length());
+		nodes.reserve(len);
+		positions.reserve(len);
+		for (auto node : dl) {
+			if constexpr (!std::is_same_v<T, Argument::Typed::Any>) {
+				if (node.type() != Argument::WrapperIndex<T>) {
+					ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+				}
+			}
+			if (auto name = node.name(); !name.empty()) {
+				positions.try_emplace(name, static_cast<mint>(nodes.size()));
+			}
+			nodes.push_back(node.node);
+		}
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DATALISTINDEX_H
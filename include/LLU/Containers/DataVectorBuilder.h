@@ -0,0 +1,531 @@
+/**
+ * @file	DataVectorBuilder.h
+ * @date	October 19, 2026
+ * @brief	Definition of append-only builders that assemble DataVectors (TabularColumns) element by element.
+ */
+#ifndef LLU_CONTAINERS_DATAVECTORBUILDER_H
+#define LLU_CONTAINERS_DATAVECTORBUILDER_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "LLU/Containers/Generic/DataVector.hpp"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/UniquePtr.h"
+#include "LLU/Utilities.hpp"
+
+namespace LLU {
+
+	namespace DV {
+
+		namespace Detail {
+			/// Smallest capacity allocated by a builder buffer
+			inline constexpr mint MinBufferCapacity = 16;
+
+			/// Capacity to grow a buffer of capacity \p cap to, so that at least \p required elements fit
+			inline mint grownCapacity(mint cap, mint required) noexcept {
+				return std::max({required, 2 * cap, MinBufferCapacity});
+			}
+
+			/**
+			 * @brief   Geometrically growing buffer of elements of type T stored directly in a one-dimensional NumericArray.
+			 * @details When the final number of elements matches the capacity (for example because it was reserved up front) the NumericArray is handed
+			 *          over to the DataVector as is, otherwise it is shrunk with a single copy.
+			 */
+			template<typename T>
+			class NumericBuffer {
+			public:
+				void reserve(mint n) {
+					if (n > cap) {
+						reallocate(n);
+					}
+				}
+
+				[[nodiscard]] mint size() const noexcept {
+					return count;
+				}
+
+				void push_back(T value) {
+					if (count == cap) {
+						reallocate(grownCapacity(cap, count + 1));
+					}
+					array[count++] = value;
+				}
+
+				T* extend(mint n) {
+					if (count + n > cap) {
+						reallocate(grownCapacity(cap, count + n));
+					}
+					T* dest = array.data() + count;
+					count += n;
+					return dest;
+				}
+
+				NumericArray<T> release() {
+					if (count != cap || !array.getContainer()) {
+						reallocate(count);
+					}
+					count = 0;
+					cap = 0;
+					return std::move(array);
+				}
+
+			private:
+				void reallocate(mint new_cap) {
+					NumericArray<T> new_array {GenericNumericArray {NumericArrayType<T>, 1, &new_cap}};
+					if (count > 0) {
+						std::copy_n(array.data(), count, new_array.data());
+					}
+					array = std::move(new_array);
+					cap = new_cap;
+				}
+
+				NumericArray<T> array;
+				mint count = 0;
+				mint cap = 0;
+			};
+
+			/**
+			 * @brief   Geometrically growing buffer of elements of type T allocated with the LibraryLink allocator.
+			 * @details The buffer is passed to LibraryLink as is, so the unused capacity is never copied away.
+			 */
+			template<typename T>
+			class RawBuffer {
+			public:
+				void reserve(mint n) {
+					if (n > cap) {
+						reallocate(n);
+					}
+				}
+
+				[[nodiscard]] mint size() const noexcept {
+					return count;
+				}
+
+				[[nodiscard]] T back() const noexcept {
+					return buffer[count - 1];
+				}
+
+				void push_back(T value) {
+					if (count == cap) {
+						reallocate(grownCapacity(cap, count + 1));
+					}
+					buffer[count++] = value;
+				}
+
+				T* extend(mint n) {
+					if (count + n > cap) {
+						reallocate(grownCapacity(cap, count + n));
+					}
+					T* dest = buffer.get() + count;
+					count += n;
+					return dest;
+				}
+
+				UniquePtr<T[]> release() {
+					if (!buffer) {
+						reallocate(1);
+					}
+					count = 0;
+					cap = 0;
+					return std::move(buffer);
+				}
+
+			private:
+				void reallocate(mint new_cap) {
+					auto new_buffer = makeUnique<T[]>(static_cast<std::size_t>(new_cap));
+					if (count > 0) {
+						std::memcpy(new_buffer.get(), buffer.get(), static_cast<std::size_t>(count) * sizeof(T));
+					}
+					buffer = std::move(new_buffer);
+					cap = new_cap;
+				}
+
+				UniquePtr<T[]> buffer;
+				mint count = 0;
+				mint cap = 0;
+			};
+
+			/**
+			 * @brief   Common part of builders of columns that store one fixed-size value per element.
+			 * @tparam  T - type of values stored in the underlying NumericArray
+			 */
+			template<typename T>
+			class FixedWidthColumnBuilder {
+			public:
+				/// Get the number of elements appended so far
+				[[nodiscard]] mint length() const noexcept {
+					return values.size();
+				}
+
+				/// Get the number of missing elements appended so far
+				[[nodiscard]] mint missingCount() const noexcept {
+					return validity.missingCount();
+				}
+
+				/**
+				 * @brief   Reserve space for at least \p n elements. When exactly \p n elements are appended, finish() does not copy the values.
+				 * @param   n - expected number of elements
+				 */
+				void reserve(mint n) {
+					values.reserve(n);
+					validity.reserve(static_cast<std::size_t>(n));
+				}
+
+				/// Append a missing element
+				void appendNull() {
+					values.push_back(T {});
+					validity.append(false);
+				}
+
+			protected:
+				void appendValue(T value) {
+					values.push_back(value);
+					validity.append(true);
+				}
+
+				template<std::ranges::input_range R>
+				void appendValues(R&& range) {
+					if constexpr (std::ranges::sized_range<R>) {
+						const auto n = static_cast<mint>(std::ranges::size(range));
+						std::ranges::transform(range, values.extend(n), [](const auto& v) { return static_cast<T>(v); });
+						validity.append(true, static_cast<std::size_t>(n));
+					} else {
+						for (auto&& v : range) {
+							appendValue(static_cast<T>(v));
+						}
+					}
+				}
+
+				NumericBuffer<T> values;
+				ValidityBitmap validity;
+			};
+		}  // namespace Detail
+	}  // namespace DV
+
+	/**
+	 * @class   NumericColumnBuilder
+	 * @brief   Append-only builder of a numeric DataVector.
+	 * @tparam  T - type of column elements, any type supported by NumericArray
+	 */
+	template<typename T>
+	class NumericColumnBuilder : public DV::Detail::FixedWidthColumnBuilder<T> {
+	public:
+		/// Column elements are of type T
+		using value_type = T;
+
+		NumericColumnBuilder() = default;
+
+		/**
+		 * @brief   Create a builder with space reserved for \p capacity elements
+		 * @param   capacity - expected number of elements
+		 */
+		explicit NumericColumnBuilder(mint capacity) {
+			this->reserve(capacity);
+		}
+
+		/// Append a present element
+		void append(T value) {
+			this->appendValue(value);
+		}
+
+		/**
+		 * @brief   Append all elements from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to T
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			this->appendValues(std::forward<R>(range));
+		}
+
+		/**
+		 * @brief   Move the collected elements into a new DataVector and reset the builder.
+		 * @return  numeric DataVector
+		 */
+		DataVector finish() {
+			auto validity = std::exchange(this->validity, {}).toInt8Array();
+			return DataVector {DV::Type::Numeric, this->values.release(), validity};
+		}
+	};
+
+	/**
+	 * @class   BooleanColumnBuilder
+	 * @brief   Append-only builder of a boolean DataVector.
+	 */
+	class BooleanColumnBuilder : public DV::Detail::FixedWidthColumnBuilder<std::int8_t> {
+	public:
+		/// Column elements are booleans
+		using value_type = bool;
+
+		BooleanColumnBuilder() = default;
+
+		/**
+		 * @brief   Create a builder with space reserved for \p capacity elements
+		 * @param   capacity - expected number of elements
+		 */
+		explicit BooleanColumnBuilder(mint capacity) {
+			reserve(capacity);
+		}
+
+		/// Append a present element
+		void append(bool value) {
+			appendValue(static_cast<std::int8_t>(value));
+		}
+
+		/**
+		 * @brief   Append all elements from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to bool
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			appendValues(range | std::views::transform([](const auto& v) { return static_cast<bool>(v); }));
+		}
+
+		/**
+		 * @brief   Move the collected elements into a new DataVector and reset the builder.
+		 * @return  boolean DataVector
+		 */
+		DataVector finish();
+	};
+
+	/**
+	 * @class   DateColumnBuilder
+	 * @brief   Append-only builder of a date DataVector.
+	 * @tparam  T - integer type used to store dates, counted in units given by the granularity
+	 */
+	template<typename T = std::int64_t>
+	class DateColumnBuilder : public DV::Detail::FixedWidthColumnBuilder<T> {
+	public:
+		/// Column elements are of type T
+		using value_type = T;
+
+		/**
+		 * @brief   Create a builder of a date column
+		 * @param   granularity - date granularity
+		 * @param   precision - date precision
+		 * @param   time_zone - time zone, empty string means no time zone
+		 */
+		DateColumnBuilder(mint granularity, mint precision, std::string time_zone = {})
+			: granularity {granularity}, precision {precision}, timeZone {std::move(time_zone)} {}
+
+		/// Append a present element
+		void append(T value) {
+			this->appendValue(value);
+		}
+
+		/**
+		 * @brief   Append all elements from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to T
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			this->appendValues(std::forward<R>(range));
+		}
+
+		/**
+		 * @brief   Move the collected elements into a new DataVector and reset the builder.
+		 * @return  date DataVector
+		 */
+		DataVector finish() {
+			auto validity = std::exchange(this->validity, {}).toInt8Array();
+			return DataVector {this->values.release(), granularity, precision, timeZone, validity};
+		}
+
+	private:
+		mint granularity;
+		mint precision;
+		std::string timeZone;
+	};
+
+	/**
+	 * @class   TimeColumnBuilder
+	 * @brief   Append-only builder of a time DataVector.
+	 * @tparam  T - integer type used to store times, counted in units given by the granularity
+	 */
+	template<typename T = std::int64_t>
+	class TimeColumnBuilder : public DV::Detail::FixedWidthColumnBuilder<T> {
+	public:
+		/// Column elements are of type T
+		using value_type = T;
+
+		/**
+		 * @brief   Create a builder of a time column
+		 * @param   granularity - time granularity
+		 * @param   precision - time precision
+		 */
+		TimeColumnBuilder(mint granularity, mint precision) : granularity {granularity}, precision {precision} {}
+
+		/// Append a present element
+		void append(T value) {
+			this->appendValue(value);
+		}
+
+		/**
+		 * @brief   Append all elements from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to T
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			this->appendValues(std::forward<R>(range));
+		}
+
+		/**
+		 * @brief   Move the collected elements into a new DataVector and reset the builder.
+		 * @return  time DataVector
+		 */
+		DataVector finish() {
+			auto validity = std::exchange(this->validity, {}).toInt8Array();
+			return DataVector {this->values.release(), granularity, precision, validity};
+		}
+
+	private:
+		mint granularity;
+		mint precision;
+	};
+
+	/**
+	 * @class   StringColumnBuilder
+	 * @brief   Append-only builder of a string DataVector.
+	 * @details Characters and offsets are collected in buffers allocated with the LibraryLink allocator, which are passed to the DataVector without
+	 *          any copies when the builder is finished.
+	 */
+	class StringColumnBuilder {
+	public:
+		/// Column elements are strings
+		using value_type = std::string_view;
+
+		StringColumnBuilder();
+
+		/**
+		 * @brief   Create a builder with space reserved for \p capacity strings with \p char_capacity characters in total
+		 * @param   capacity - expected number of strings
+		 * @param   char_capacity - expected total number of characters
+		 */
+		explicit StringColumnBuilder(mint capacity, mint char_capacity = 0);
+
+		/// Get the number of elements appended so far
+		[[nodiscard]] mint length() const noexcept {
+			return offsets.size() - 1;
+		}
+
+		/// Get the number of missing elements appended so far
+		[[nodiscard]] mint missingCount() const noexcept {
+			return validity.missingCount();
+		}
+
+		/**
+		 * @brief   Reserve space for at least \p n strings with \p char_count characters in total
+		 * @param   n - expected number of strings
+		 * @param   char_count - expected total number of characters
+		 */
+		void reserve(mint n, mint char_count = 0);
+
+		/// Append a present element
+		void append(std::string_view str);
+
+		/// Append a missing element
+		void appendNull();
+
+		/**
+		 * @brief   Append all strings from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to std::string_view
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			if constexpr (std::ranges::sized_range<R>) {
+				reserve(length() + static_cast<mint>(std::ranges::size(range)));
+			}
+			for (auto&& str : range) {
+				append(std::string_view {str});
+			}
+		}
+
+		/**
+		 * @brief   Move the collected strings into a new DataVector and reset the builder.
+		 * @return  string DataVector
+		 */
+		DataVector finish();
+
+	private:
+		DV::Detail::RawBuffer<char> characters;
+		DV::Detail::RawBuffer<mint> offsets;
+		DV::ValidityBitmap validity;
+	};
+
+	/**
+	 * @class   BinaryColumnBuilder
+	 * @brief   Append-only builder of a binary DataVector, where each element is a byte array of arbitrary length.
+	 */
+	class BinaryColumnBuilder {
+	public:
+		/// Column elements are byte arrays
+		using value_type = std::span<const std::uint8_t>;
+
+		BinaryColumnBuilder();
+
+		/**
+		 * @brief   Create a builder with space reserved for \p capacity byte arrays with \p byte_capacity bytes in total
+		 * @param   capacity - expected number of byte arrays
+		 * @param   byte_capacity - expected total number of bytes
+		 */
+		explicit BinaryColumnBuilder(mint capacity, mint byte_capacity = 0);
+
+		/// Get the number of elements appended so far
+		[[nodiscard]] mint length() const noexcept {
+			return offsets.size() - 1;
+		}
+
+		/// Get the number of missing elements appended so far
+		[[nodiscard]] mint missingCount() const noexcept {
+			return validity.missingCount();
+		}
+
+		/**
+		 * @brief   Reserve space for at least \p n byte arrays with \p byte_count bytes in total
+		 * @param   n - expected number of byte arrays
+		 * @param   byte_count - expected total number of bytes
+		 */
+		void reserve(mint n, mint byte_count = 0);
+
+		/// Append a present element
+		void append(std::span<const std::uint8_t> data);
+
+		/// Append a missing element
+		void appendNull();
+
+		/**
+		 * @brief   Append all byte arrays from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to std::span<const std::uint8_t>
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			if constexpr (std::ranges::sized_range<R>) {
+				reserve(length() + static_cast<mint>(std::ranges::size(range)));
+			}
+			for (auto&& elem : range) {
+				append(std::span<const std::uint8_t> {elem});
+			}
+		}
+
+		/**
+		 * @brief   Move the collected byte arrays into a new DataVector and reset the builder.
+		 * @return  binary DataVector
+		 */
+		DataVector finish();
+
+	private:
+		DV::Detail::NumericBuffer<std::uint8_t> bytes;
+		DV::Detail::RawBuffer<mint> offsets;
+		DV::ValidityBitmap validity;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DATAVECTORBUILDER_H
@@ -0,0 +1,343 @@
+/**
+ * @file	DataVectorKernels.h
+ * @date	October 19, 2026
+ * @brief	Column operations (filters, gathers, casts, aggregations and grouping) working directly on DataVector data.
+ */
+#ifndef LLU_CONTAINERS_DATAVECTORKERNELS_H
+#define LLU_CONTAINERS_DATAVECTORKERNELS_H
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "LLU/Async/ThreadPool.h"
+#include "LLU/Containers/Generic/DataVector.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/UniquePtr.h"
+
+namespace LLU::DV {
+
+	/// Row indices of a DataVector, as produced by the filters and consumed by take()
+	using SelectionVector = std::vector<mint>;
+
+	/**
+	 * @brief   Null-aware summary of the values in a numeric column.
+	 * @details Missing elements are skipped. Values are accumulated as doubles, so sums of very large 64-bit integers may be rounded.
+	 */
+	struct Summary {
+		/// Number of elements that are not missing
+		mint count = 0;
+
+		/// Sum of elements that are not missing
+		double sum = 0.0;
+
+		/// Smallest element, +Infinity if there are no elements
+		double min = std::numeric_limits<double>::infinity();
+
+		/// Largest element, -Infinity if there are no elements
+		double max = -std::numeric_limits<double>::infinity();
+
+		/// Get the mean of elements that are not missing, NaN if there are no such elements
+		[[nodiscard]] double mean() const noexcept {
+			return count > 0 ? sum / static_cast<double>(count) : std::numeric_limits<double>::quiet_NaN();
+		}
+
+		/// Add a single value to the summary
+		void add(double value) noexcept {
+			++count;
+			sum += value;
+			min = value < min ? value : min;
+			max = value > max ? value : max;
+		}
+
+		/// Combine with a summary of a disjoint set of elements
+		void merge(const Summary& other) noexcept {
+			count += other.count;
+			sum += other.sum;
+			min = other.min < min ? other.min : min;
+			max = other.max > max ? other.max : max;
+		}
+	};
+
+	/**
+	 * @brief   Assignment of rows of a DataVector to groups of rows with equal keys.
+	 * @details Groups are numbered in the order in which their keys first appear in the column.
+	 */
+	struct Grouping {
+		/// Group index of each row, -1 for rows where the key is missing
+		std::vector<mint> groups;
+
+		/// Row in which the key of each group first appears
+		std::vector<mint> firstRows;
+
+		/// Get the number of groups
+		[[nodiscard]] mint groupCount() const noexcept {
+			return static_cast<mint>(firstRows.size());
+		}
+	};
+
+	namespace Detail {
+		/// Minimal number of rows processed by a single thread in column operations
+		inline constexpr std::size_t MinRowsPerThread = 1 << 16;
+
+		/**
+		 * @brief   Get the number of chunks a column should be split into for parallel processing
+		 * @param   rows - number of rows in the column
+		 * @param   thread_count - maximal number of threads to use, 0 means the hardware concurrency
+		 */
+		unsigned chunkCount(std::size_t rows, unsigned thread_count);
+
+		/**
+		 * @brief   Call f(chunk, begin, end) for each of \p chunk_count contiguous chunks of [0, rows), in parallel.
+		 * @details The first chunk is processed in the calling thread and the others on a BasicPool. An exception thrown from any of the calls is
+		 *          rethrown in the calling thread after all chunks are finished.
+		 */
+		template<typename F>
+		void forEachChunk(std::size_t rows, unsigned chunk_count, F&& f) {
+			if (chunk_count <= 1) {
+				f(std::size_t {0}, std::size_t {0}, rows);
+				return;
+			}
+			const auto chunk_size = (rows + chunk_count - 1) / chunk_count;
+			const auto runChunk = [&f, rows, chunk_size](std::size_t c) { f(c, std::min(c * chunk_size, rows), std::min((c + 1) * chunk_size, rows)); };
+			BasicPool pool {chunk_count - 1};
+			std::vector<std::future<void>> results;
+			results.reserve(chunk_count - 1);
+			for (std::size_t c = 1; c < chunk_count; ++c) {
+				results.push_back(pool.submit(runChunk, c));
+			}
+			std::exception_ptr error;
+			try {
+				runChunk(0);
+			} catch (...) {
+				error = std::current_exception();
+			}
+			// the pool may drop tasks that have not started when it is destroyed, so every future must be waited for
+			for (auto& r : results) {
+				try {
+					r.get();
+				} catch (...) {
+					if (!error) {
+						error = std::current_exception();
+					}
+				}
+			}
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+
+		/**
+		 * @brief   Call \p f with std::type_identity<T>, where T is the C++ type corresponding to given NumericArray type
+		 * @throws  ErrorName::NumericArrayTypeError - if \p t is not a valid NumericArray type
+		 */
+		template<typename F>
+		decltype(auto) visitNumericType(numericarray_data_t t, F&& f) {
+			switch (t) {
+				case MNumericArray_Type_Bit8: return std::forward<F>(f)(std::type_identity<std::int8_t> {});
+				case MNumericArray_Type_UBit8: return std::forward<F>(f)(std::type_identity<std::uint8_t> {});
+				case MNumericArray_Type_Bit16: return std::forward<F>(f)(std::type_identity<std::int16_t> {});
+				case MNumericArray_Type_UBit16: return std::forward<F>(f)(std::type_identity<std::uint16_t> {});
+				case MNumericArray_Type_Bit32: return std::forward<F>(f)(std::type_identity<std::int32_t> {});
+				case MNumericArray_Type_UBit32: return std::forward<F>(f)(std::type_identity<std::uint32_t> {});
+				case MNumericArray_Type_Bit64: return std::forward<F>(f)(std::type_identity<std::int64_t> {});
+				case MNumericArray_Type_UBit64: return std::forward<F>(f)(std::type_identity<std::uint64_t> {});
+				case MNumericArray_Type_Real32: return std::forward<F>(f)(std::type_identity<float> {});
+				case MNumericArray_Type_Real64: return std::forward<F>(f)(std::type_identity<double> {});
+				case MNumericArray_Type_Complex_Real32: return std::forward<F>(f)(std::type_identity<std::complex<float>> {});
+				case MNumericArray_Type_Complex_Real64: return std::forward<F>(f)(std::type_identity<std::complex<double>> {});
+				default: ErrorManager::throwException(ErrorName::NumericArrayTypeError);
+			}
+		}
+
+		/**
+		 * @brief   Get the numeric data of a Numeric, Date or Time DataVector
+		 * @param   dv - a DataVector
+		 * @param   operation - name of the operation, used in the error message
+		 * @throws  ErrorName::DVKernelType - if \p dv is of any other type
+		 */
+		NumericData numericData(const DataVector& dv, const std::string& operation);
+
+		/// Select rows in [0, rows) for which \p test returns true, using multiple threads for large columns
+		template<typename Test>
+		SelectionVector select(std::size_t rows, unsigned thread_count, Test&& test) {
+			const auto chunks = chunkCount(rows, thread_count);
+			std::vector<SelectionVector> partial(chunks);
+			forEachChunk(rows, chunks, [&](std::size_t c, std::size_t begin, std::size_t end) {
+				for (auto i = begin; i < end; ++i) {
+					if (test(i)) {
+						partial[c].push_back(static_cast<mint>(i));
+					}
+				}
+			});
+			if (chunks == 1) {
+				return std::move(partial.front());
+			}
+			SelectionVector result;
+			std::size_t total = 0;
+			for (const auto& p : partial) {
+				total += p.size();
+			}
+			result.reserve(total);
+			for (const auto& p : partial) {
+				result.insert(result.end(), p.begin(), p.end());
+			}
+			return result;
+		}
+	}  // namespace Detail
+
+	/**
+	 * @brief   Select rows of a Numeric, Date or Time column whose values satisfy a predicate. Missing elements are never selected.
+	 * @param   dv - a DataVector
+	 * @param   pred - predicate called with values of the column's element type (e.g. std::int32_t or double), must be thread-safe
+	 * @param   thread_count - maximal number of threads to use for large columns, 0 means the hardware concurrency
+	 * @return  indices of selected rows in increasing order
+	 * @throws  ErrorName::DVKernelType - if \p dv is of another type or stores complex numbers
+	 */
+	template<typename Pred>
+	SelectionVector filter(const DataVector& dv, Pred&& pred, unsigned thread_count = 0) {
+		const auto data = Detail::numericData(dv, "filter");
+		const auto valid = dv.validityBitmap();
+		return Detail::visitNumericType(data.type, [&]<typename T>(std::type_identity<T>) -> SelectionVector {
+			if constexpr (std::is_arithmetic_v<T>) {
+				const auto* values = static_cast<const T*>(data.raw_data);
+				return Detail::select(data.length, thread_count, [&](std::size_t i) { return valid[i] && pred(values[i]); });
+			} else {
+				ErrorManager::throwException(ErrorName::DVKernelType, "filter", "Complex");
+			}
+		});
+	}
+
+	/**
+	 * @brief   Select rows of a String column whose values satisfy a predicate. Missing elements are never selected.
+	 * @param   dv - a DataVector
+	 * @param   pred - predicate called with std::string_view, must be thread-safe
+	 * @param   thread_count - maximal number of threads to use for large columns, 0 means the hardware concurrency
+	 * @return  indices of selected rows in increasing order
+	 * @throws  ErrorName::DVKernelType - if \p dv is not a String column
+	 */
+	template<typename Pred>
+	SelectionVector filterStrings(const DataVector& dv, Pred&& pred, unsigned thread_count = 0) {
+		const auto data = dv.viewData();
+		const auto* strings = std::get_if<StringData>(&data);
+		if (!strings) {
+			ErrorManager::throwException(ErrorName::DVKernelType, "filterStrings", typeName(dv.type()));
+		}
+		const auto valid = dv.validityBitmap();
+		const auto rows = strings->offsets.size() - 1;
+		return Detail::select(rows, thread_count, [&](std::size_t i) {
+			const auto begin = static_cast<std::size_t>(strings->offsets[i]);
+			const auto end = static_cast<std::size_t>(strings->offsets[i + 1]);
+			return valid[i] && pred(strings->characters.substr(begin, end - begin));
+		});
+	}
+
+	/**
+	 * @brief   Create a new DataVector of the same type with rows at given positions, in the given order. Missing elements stay missing.
+	 * @param   dv - a DataVector of any type
+	 * @param   indices - positions of rows to take, may contain repetitions
+	 * @throws  ErrorName::DVIndexError - if any index is out of range
+	 */
+	DataVector take(const DataVector& dv, std::span<const mint> indices);
+
+	/**
+	 * @brief   Convert a Numeric column to another real numeric type.
+	 * @details Values are converted with static_cast. Values that cannot be represented in the target integer type (out of range, infinite
+	 *          or NaN) become missing.
+	 * @param   dv - a Numeric DataVector with real elements
+	 * @param   type - target NumericArray type
+	 * @throws  ErrorName::DVKernelType - if \p dv is not a Numeric column, or either type is complex
+	 */
+	DataVector cast(const DataVector& dv, numericarray_data_t type);
+
+	/**
+	 * @brief   Summarize the elements of a Numeric, Date or Time column, skipping missing elements.
+	 * @param   dv - a DataVector with real elements
+	 * @param   thread_count - maximal number of threads to use for large columns, 0 means the hardware concurrency
+	 * @throws  ErrorName::DVKernelType - if \p dv is of another type or stores complex numbers
+	 */
+	Summary summarize(const DataVector& dv, unsigned thread_count = 0);
+
+	/**
+	 * @brief   Group rows of a column by equal values using a hash table.
+	 * @param   keys - a Numeric (with real elements), Date, Time, String or Boolean DataVector
+	 * @throws  ErrorName::DVKernelType - if the column type cannot be used for grouping
+	 */
+	Grouping groupBy(const DataVector& keys);
+
+	/**
+	 * @brief   Summarize the values in each group of rows.
+	 * @param   grouping - grouping of rows, typically obtained from groupBy()
+	 * @param   values - a column of the same length as the grouped column, with the same requirements as in summarize()
+	 * @return  summary for each group
+	 * @throws  ErrorName::DVLengthMismatch - if the lengths of the grouped column and \p values differ
+	 */
+	std::vector<Summary> summarizeGroups(const Grouping& grouping, const DataVector& values);
+
+	/// Minimal number of lengths processed by a single thread in the parallel version of lengthsToOffsets
+	inline constexpr std::size_t MinLengthsPerThread = 1 << 16;
+
+	/**
+	 * @brief   Compute offsets of consecutive elements of given lengths on a thread pool.
+	 * @details Each task computes a prefix sum of one block of lengths, then block totals are accumulated and added to the blocks in parallel.
+	 *          Short inputs, for which splitting the work does not pay off, are processed sequentially in the calling thread. The pool is only
+	 *          borrowed, so a caller that computes offsets repeatedly can keep its threads alive between calls.
+	 * @param   lengths - lengths of elements
+	 * @param   pool - thread pool to run the blocks on
+	 * @param   thread_count - number of threads in \p pool, which is the maximal number of blocks
+	 * @return  array of lengths.size() + 1 offsets, starting with 0
+	 */
+	template<typename T>
+	UniquePtr<mint[]> lengthsToOffsets(std::span<T> lengths, BasicPool& pool, unsigned thread_count) {
+		const auto elem_count = lengths.size();
+		const auto block_count = std::clamp<std::size_t>(elem_count / MinLengthsPerThread, 1, std::max(thread_count, 1U));
+		if (block_count == 1) {
+			return lengthsToOffsets(lengths);
+		}
+		auto offsets = makeUnique<mint[]>(elem_count + 1);
+		offsets[0] = 0;
+		const auto block_size = (elem_count + block_count - 1) / block_count;
+		const auto blockBegin = [&](std::size_t block) { return std::min(block * block_size, elem_count); };
+
+		std::vector<mint> block_base(block_count, 0);
+		std::vector<std::future<void>> results;
+		results.reserve(block_count);
+		for (std::size_t b = 0; b < block_count; ++b) {
+			results.push_back(pool.submit([&, b] {
+				mint sum = 0;
+				for (auto i = blockBegin(b); i < blockBegin(b + 1); ++i) {
+					sum += static_cast<mint>(lengths[i]);
+					offsets[i + 1] = sum;
+				}
+				block_base[b] = sum;
+			}));
+		}
+		for (auto& r : results) {
+			r.get();
+		}
+		std::exclusive_scan(block_base.begin(), block_base.end(), block_base.begin(), mint {0});
+		results.clear();
+		for (std::size_t b = 1; b < block_count; ++b) {
+			results.push_back(pool.submit([&, b] {
+				for (auto i = blockBegin(b); i < blockBegin(b + 1); ++i) {
+					offsets[i + 1] += block_base[b];
+				}
+			}));
+		}
+		for (auto& r : results) {
+			r.get();
+		}
+		return offsets;
+	}
+
+}  // namespace LLU::DV
+
+#endif	  // LLU_CONTAINERS_DATAVECTORKERNELS_H
@@ -0,0 +1,284 @@
+/**
+ * @file	DictionaryColumn.h
+ * @date	October 19, 2026
+ * @brief	Definition of DictionaryColumn - dictionary-encoded representation of string DataVectors.
+ */
+#ifndef LLU_CONTAINERS_DICTIONARYCOLUMN_H
+#define LLU_CONTAINERS_DICTIONARYCOLUMN_H
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "LLU/Containers/DataVectorBuilder.h"
+#include "LLU/Containers/DataVectorKernels.h"
+#include "LLU/Containers/Generic/DataVector.hpp"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU {
+
+	/**
+	 * @class   DictionaryColumn
+	 * @brief   Column of strings stored as a dictionary of distinct values and one integer code per row.
+	 * @details Codes are assigned in the order in which values first appear in the column, and missing elements have code -1. A DictionaryColumn
+	 *          can be created from a string DataVector with encode() or filled element by element like a StringColumnBuilder. The string DataVector
+	 *          is only reconstructed when decode() is called.
+	 *          DictionaryColumn is movable but not copyable, because its hash table points into the dictionary it owns.
+	 * @tparam  Code - type of codes, std::int16_t or std::int32_t
+	 */
+	template<typename Code = std::int32_t>
+	class DictionaryColumn {
+		static_assert(std::is_same_v<Code, std::int16_t> || std::is_same_v<Code, std::int32_t>, "DictionaryColumn codes must be Integer16 or Integer32.");
+
+	public:
+		/// Type of codes
+		using code_type = Code;
+
+		/// Code of missing elements
+		static constexpr Code MissingCode = -1;
+
+		/// Maximal number of distinct values
+		static constexpr mint MaxDictionarySize = static_cast<mint>(std::numeric_limits<Code>::max()) + 1;
+
+		DictionaryColumn() = default;
+		DictionaryColumn(const DictionaryColumn&) = delete;
+		DictionaryColumn& operator=(const DictionaryColumn&) = delete;
+		DictionaryColumn(DictionaryColumn&&) noexcept = default;
+		DictionaryColumn& operator=(DictionaryColumn&&) noexcept = default;
+		~DictionaryColumn() = default;
+
+		/**
+		 * @brief   Encode a string DataVector in a single hash pass.
+		 * @details Large columns are split into chunks encoded on separate threads with local dictionaries, which are then merged in order, so the
+		 *          result is the same as with sequential encoding.
+		 * @param   dv - a String DataVector
+		 * @param   thread_count - maximal number of threads to use, 0 means the hardware concurrency
+		 * @throws  ErrorName::DVKernelType - if \p dv is not a String column
+		 * @throws  ErrorName::DVDictionaryFull - if there are more distinct values than codes of type \p Code
+		 */
+		static DictionaryColumn encode(const DataVector& dv, unsigned thread_count = 0);
+
+		/// Get the number of elements
+		[[nodiscard]] mint length() const noexcept {
+			return static_cast<mint>(codeValues.size());
+		}
+
+		/// Get the number of missing elements
+		[[nodiscard]] mint missingCount() const noexcept {
+			return missing;
+		}
+
+		/// Get the number of distinct values
+		[[nodiscard]] mint dictionarySize() const noexcept {
+			return static_cast<mint>(dictionary.size());
+		}
+
+		/// Get the codes of all elements
+		[[nodiscard]] std::span<const Code> codes() const noexcept {
+			return codeValues;
+		}
+
+		/// Get the dictionary value with given code. The code is not checked.
+		[[nodiscard]] std::string_view value(Code code) const noexcept {
+			return dictionary[static_cast<std::size_t>(code)];
+		}
+
+		/**
+		 * @brief   Get the code of given value
+		 * @return  code of \p str or -1 if \p str is not in the dictionary
+		 */
+		[[nodiscard]] Code find(std::string_view str) const {
+			auto it = lookup.find(str);
+			return it == lookup.end() ? MissingCode : it->second;
+		}
+
+		/// Append a present element
+		void append(std::string_view str) {
+			codeValues.push_back(codeOf(str));
+		}
+
+		/// Append a missing element
+		void appendNull() {
+			codeValues.push_back(MissingCode);
+			++missing;
+		}
+
+		/**
+		 * @brief   Append all strings from a range, none of them is missing
+		 * @param   range - any input range whose elements are convertible to std::string_view
+		 */
+		template<std::ranges::input_range R>
+		void appendRange(R&& range) {
+			if constexpr (std::ranges::sized_range<R>) {
+				codeValues.reserve(codeValues.size() + std::ranges::size(range));
+			}
+			for (auto&& str : range) {
+				append(std::string_view {str});
+			}
+		}
+
+		/**
+		 * @brief   Assign rows to groups of equal values. Group indices are equal to codes, so no hashing is needed.
+		 */
+		[[nodiscard]] DV::Grouping grouping() const;
+
+		/// Create a String DataVector with all elements
+		[[nodiscard]] DataVector decode() const;
+
+		/// Create a Numeric DataVector with codes of all elements, missing elements stay missing
+		[[nodiscard]] DataVector codesColumn() const;
+
+		/// Create a String DataVector with the distinct values, ordered by their codes
+		[[nodiscard]] DataVector dictionaryColumn() const;
+
+	private:
+		/// Get the code of a value, adding it to the dictionary if needed
+		Code codeOf(std::string_view str) {
+			if (auto it = lookup.find(str); it != lookup.end()) {
+				return it->second;
+			}
+			if (dictionarySize() == MaxDictionarySize) {
+				ErrorManager::throwException(ErrorName::DVDictionaryFull, MaxDictionarySize);
+			}
+			const auto& stored = dictionary.emplace_back(str);
+			const auto code = static_cast<Code>(dictionary.size() - 1);
+			lookup.emplace(stored, code);
+			return code;
+		}
+
+		/// Distinct values, a deque keeps them in place as the dictionary grows
+		std::deque<std::string> dictionary;
+
+		/// Maps values to codes, keys point to strings in the dictionary
+		std::unordered_map<std::string_view, Code> lookup;
+
+		/// Code of each element
+		std::vector<Code> codeValues;
+
+		/// Number of missing elements
+		mint missing = 0;
+	};
+
+	template<typename Code>
+	DictionaryColumn<Code> DictionaryColumn<Code>::encode(const DataVector& dv, unsigned thread_count) {
+		const auto data = dv.viewData();
+		const auto* strings = std::get_if<DV::StringData>(&data);
+		if (!strings) {
+			ErrorManager::throwException(ErrorName::DVKernelType, "encode", DV::typeName(dv.type()));
+		}
+		const auto valid = dv.validityBitmap();
+		const auto rows = strings->offsets.size() - 1;
+		const auto stringAt = [strings](std::size_t i) {
+			const auto begin = static_cast<std::size_t>(strings->offsets[i]);
+			return strings->characters.substr(begin, static_cast<std::size_t>(strings->offsets[i + 1]) - begin);
+		};
+
+		DictionaryColumn result;
+		result.codeValues.resize(rows);
+		result.missing = dv.missingCount();
+		const auto chunks = DV::Detail::chunkCount(rows, thread_count);
+		if (chunks == 1) {
+			for (std::size_t i = 0; i < rows; ++i) {
+				result.codeValues[i] = valid[i] ? result.codeOf(stringAt(i)) : MissingCode;
+			}
+			return result;
+		}
+
+		// Each chunk gets a local dictionary with local codes, distinct values are kept in the order of first appearance
+		std::vector<std::vector<std::string_view>> local_values(chunks);
+		DV::Detail::forEachChunk(rows, chunks, [&](std::size_t c, std::size_t begin, std::size_t end) {
+			std::unordered_map<std::string_view, mint> local_lookup;
+			auto& values = local_values[c];
+			for (auto i = begin; i < end; ++i) {
+				if (!valid[i]) {
+					result.codeValues[i] = MissingCode;
+					continue;
+				}
+				auto [it, inserted] = local_lookup.try_emplace(stringAt(i), static_cast<mint>(values.size()));
+				if (inserted) {
+					values.push_back(it->first);
+				}
+				// a chunk with more distinct values than there are codes makes the merge below throw, so truncated codes are never used
+				result.codeValues[i] = static_cast<Code>(it->second < MaxDictionarySize ? it->second : MissingCode);
+			}
+		});
+
+		// Merge local dictionaries in chunk order and remap local codes to global ones
+		std::vector<std::vector<Code>> remap(chunks);
+		for (std::size_t c = 0; c < chunks; ++c) {
+			remap[c].reserve(local_values[c].size());
+			for (auto str : local_values[c]) {
+				remap[c].push_back(result.codeOf(str));
+			}
+		}
+		DV::Detail::forEachChunk(rows, chunks, [&](std::size_t c, std::size_t begin, std::size_t end) {
+			for (auto i = begin; i < end; ++i) {
+				if (auto& code = result.codeValues[i]; code != MissingCode) {
+					code = remap[c][static_cast<std::size_t>(code)];
+				}
+			}
+		});
+		return result;
+	}
+
+	template<typename Code>
+	DV::Grouping DictionaryColumn<Code>::grouping() const {
+		DV::Grouping result;
+		result.groups.assign(codeValues.begin(), codeValues.end());
+		result.firstRows.assign(dictionary.size(), -1);
+		for (std::size_t i = 0; i < codeValues.size(); ++i) {
+			if (const auto code = codeValues[i]; code != MissingCode && result.firstRows[static_cast<std::size_t>(code)] < 0) {
+				result.firstRows[static_cast<std::size_t>(code)] = static_cast<mint>(i);
+			}
+		}
+		return result;
+	}
+
+	template<typename Code>
+	DataVector DictionaryColumn<Code>::decode() const {
+		mint char_count = 0;
+		for (auto code : codeValues) {
+			if (code != MissingCode) {
+				char_count += static_cast<mint>(dictionary[static_cast<std::size_t>(code)].size());
+			}
+		}
+		StringColumnBuilder builder {length(), char_count};
+		for (auto code : codeValues) {
+			if (code == MissingCode) {
+				builder.appendNull();
+			} else {
+				builder.append(dictionary[static_cast<std::size_t>(code)]);
+			}
+		}
+		return builder.finish();
+	}
+
+	template<typename Code>
+	DataVector DictionaryColumn<Code>::codesColumn() const {
+		NumericColumnBuilder<Code> builder {length()};
+		for (auto code : codeValues) {
+			if (code == MissingCode) {
+				builder.appendNull();
+			} else {
+				builder.append(code);
+			}
+		}
+		return builder.finish();
+	}
+
+	template<typename Code>
+	DataVector DictionaryColumn<Code>::dictionaryColumn() const {
+		StringColumnBuilder builder;
+		builder.appendRange(dictionary);
+		return builder.finish();
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_DICTIONARYCOLUMN_H
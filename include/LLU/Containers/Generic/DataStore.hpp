@@ -6,6 +6,10 @@
 #ifndef LLU_CONTAINERS_GENERIC_DATASTORE_HPP
 #define LLU_CONTAINERS_GENERIC_DATASTORE_HPP
 
+#include <ranges>
+#include <span>
+#include <string_view>
+
 #include "LLU/Containers/Generic/Base.hpp"
 #include "LLU/Containers/Generic/DataVector.hpp"
 #include "LLU/Containers/Iterators/DataStore.hpp"
@@ -17,6 +21,38 @@ namespace LLU {
 	/// MContainer specialization for DataStore is called GenericDataList
 	using GenericDataList = MContainer<MArgumentType::DataStore>;
 
+	namespace Detail {
+		/**
+		 * @brief   Get the type of DataStore node in which a value of type T is stored, or MArgumentType::MArgument if T cannot be stored directly.
+		 * @details Besides primitive LibraryLink types and their wrappers, strongly-typed containers (e.g. NumericArray<T>) are also supported
+		 *          and they are stored as their generic counterparts.
+		 */
+		template<typename T>
+		constexpr MArgumentType dataStoreNodeType() {
+			if constexpr (Argument::PrimitiveQ<T>) {
+				return Argument::PrimitiveIndex<T>;
+			} else if constexpr (Argument::WrapperQ<T> && !std::is_same_v<T, Argument::TypedArgument>) {
+				return Argument::WrapperIndex<T>;
+			} else if constexpr (std::is_base_of_v<MContainerBase<MArgumentType::Tensor>, T>) {
+				return MArgumentType::Tensor;
+			} else if constexpr (std::is_base_of_v<MContainerBase<MArgumentType::SparseArray>, T>) {
+				return MArgumentType::SparseArray;
+			} else if constexpr (std::is_base_of_v<MContainerBase<MArgumentType::NumericArray>, T>) {
+				return MArgumentType::NumericArray;
+			} else if constexpr (std::is_base_of_v<MContainerBase<MArgumentType::Image>, T>) {
+				return MArgumentType::Image;
+			} else if constexpr (std::is_base_of_v<MContainerBase<MArgumentType::DataStore>, T>) {
+				return MArgumentType::DataStore;
+			} else {
+				return MArgumentType::MArgument;
+			}
+		}
+
+		/// Type trait to determine if values of type T can be bulk-inserted into a DataStore directly from contiguous memory
+		template<typename T>
+		inline constexpr bool BulkInsertableQ = Argument::PrimitiveQ<T> && !std::is_same_v<T, MTensor>;
+	}  // namespace Detail
+
 	/**
 	 *  @brief  MContainer specialization for DataStore, provides basic list interface for the underlying raw DataStore.
 	 */
@@ -175,6 +211,27 @@ namespace LLU {
 		 */
 		void push_back(const Argument::Typed::Any& node);
 
+		/**
+		 * @brief   Add a new nameless node at the end of the underlying DataStore for every element of a range
+		 * @tparam  R - input range of primitive LibraryLink values, their wrappers, strongly-typed containers or TypedArguments
+		 * @param   values - range of values to be appended, ownership of containers is passed to the DataStore
+		 * @note    Contiguous ranges of primitive LibraryLink values (mint, mreal, mcomplex, etc.) are appended in a tight loop without
+		 *          any per-node conversions. Because MTensor and MNumericArray are the same type, ranges of raw MTensors are not supported.
+		 */
+		template<std::ranges::input_range R>
+		void append_range(R&& values);
+
+		/**
+		 * @brief   Add a new named node at the end of the underlying DataStore for every element of a range
+		 * @tparam  N - input range of node names, elements must be convertible to std::string_view and point to null-terminated strings
+		 * @tparam  R - input range of primitive LibraryLink values, their wrappers, strongly-typed containers or TypedArguments
+		 * @param   names - range of node names, must have the same length as \p values
+		 * @param   values - range of values to be appended, ownership of containers is passed to the DataStore
+		 * @throws  ErrorName::DLRangeSizeMismatch - if both ranges are sized and their sizes differ
+		 */
+		template<std::ranges::input_range N, std::ranges::input_range R>
+		void append_range(N&& names, R&& values);
+
 		/**
 		 * @brief   Add new named node at the end of the underlying DataStore
 		 * @param   name - name of the new node, names in a DataStore do not have to be unique
@@ -183,6 +240,14 @@ namespace LLU {
 		void push_back(std::string_view name, const Argument::Typed::Any& node);
 
 	private:
+		/// Append a single value of arbitrary supported type as a new node. Containers are not copied, instead their ownership is passed to the DataStore.
+		template<typename T>
+		void appendNode(const T& nodeValue);
+
+		/// Append a single value of arbitrary supported type as a new named node.
+		template<typename T>
+		void appendNode(std::string_view name, const T& nodeValue);
+
 		/// Make a deep copy of the raw container
 		Container cloneImpl() const override {
 			return LibraryData::DataStoreAPI()->copyDataStore(this->getContainer());
@@ -230,14 +295,86 @@ namespace LLU {
 		}
 	}
 
+	template<std::ranges::input_range R>
+	void GenericDataList::append_range(R&& values) {
+		using ValueType = std::ranges::range_value_t<R>;
+		if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R> && Detail::BulkInsertableQ<ValueType>) {
+			constexpr MArgumentType Type = Detail::dataStoreNodeType<ValueType>();
+			PrimitiveWrapper<Type>::addDataStoreNodes(getContainer(), std::span<const ValueType> {std::ranges::data(values), std::ranges::size(values)});
+		} else {
+			for (auto&& v : values) {
+				appendNode(v);
+			}
+		}
+	}
+
+	template<std::ranges::input_range N, std::ranges::input_range R>
+	void GenericDataList::append_range(N&& names, R&& values) {
+		using ValueType = std::ranges::range_value_t<R>;
+		if constexpr (std::ranges::sized_range<N> && std::ranges::sized_range<R>) {
+			if (std::ranges::size(names) != std::ranges::size(values)) {
+				ErrorManager::throwException(ErrorName::DLRangeSizeMismatch, static_cast<mint>(std::ranges::size(names)),
+													  static_cast<mint>(std::ranges::size(values)));
+			}
+		}
+		if constexpr (std::ranges::contiguous_range<R> && std::ranges::sized_range<R> && Detail::BulkInsertableQ<ValueType> &&
+					  std::ranges::contiguous_range<N> && std::is_same_v<std::ranges::range_value_t<N>, std::string_view>) {
+			constexpr MArgumentType Type = Detail::dataStoreNodeType<ValueType>();
+			PrimitiveWrapper<Type>::addDataStoreNodes(getContainer(), std::span<const std::string_view> {std::ranges::data(names), std::ranges::size(names)},
+													  std::span<const ValueType> {std::ranges::data(values), std::ranges::size(values)});
+		} else {
+			auto nameIt = std::ranges::begin(names);
+			for (auto&& v : values) {
+				appendNode(std::string_view {*nameIt}, v);
+				++nameIt;
+			}
+		}
+	}
+
+	template<typename T>
+	void GenericDataList::appendNode(const T& nodeValue) {
+		if constexpr (std::is_same_v<T, Argument::TypedArgument>) {
+			push_back(nodeValue);
+		} else {
+			constexpr MArgumentType Type = Detail::dataStoreNodeType<T>();
+			static_assert(Type != MArgumentType::MArgument, "Trying to append a value of unsupported type to a DataList.");
+			static_assert(!std::is_same_v<T, MTensor>, "Do not append raw MTensor or MNumericArray to a DataList, wrap them in LLU containers instead.");
+			if constexpr (Argument::PrimitiveQ<T>) {
+				PrimitiveWrapper<Type>::addDataStoreNode(getContainer(), nodeValue);
+			} else {
+				PrimitiveWrapper<Type>::addDataStoreNode(getContainer(), Argument::toPrimitiveType<Type>(nodeValue));
+			}
+		}
+	}
+
+	template<typename T>
+	void GenericDataList::appendNode(std::string_view name, const T& nodeValue) {
+		if constexpr (std::is_same_v<T, Argument::TypedArgument>) {
+			push_back(name, nodeValue);
+		} else {
+			constexpr MArgumentType Type = Detail::dataStoreNodeType<T>();
+			static_assert(Type != MArgumentType::MArgument, "Trying to append a value of unsupported type to a DataList.");
+			static_assert(!std::is_same_v<T, MTensor>, "Do not append raw MTensor or MNumericArray to a DataList, wrap them in LLU containers instead.");
+			if constexpr (Argument::PrimitiveQ<T>) {
+				PrimitiveWrapper<Type>::addDataStoreNode(getContainer(), name, nodeValue);
+			} else {
+				PrimitiveWrapper<Type>::addDataStoreNode(getContainer(), name, Argument::toPrimitiveType<Type>(nodeValue));
+			}
+		}
+	}
+
 	template<typename T>
 	T GenericDataNode::as() const {
-		auto v = value();
-		auto* ptr = std::get_if<T>(std::addressof(v));
-		if (!ptr) {
-			ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+		if constexpr (std::is_same_v<T, Argument::TypedArgument>) {
+			return value();
+		} else {
+			static_assert(Argument::WrapperQ<T>, "Node value can only be read as one of the types from LLU::NodeType namespace.");
+			constexpr MArgumentType Type = Argument::WrapperIndex<T>;
+			if (type() != Type) {
+				ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+			}
+			return Argument::fromMArgument<Type>(rawValue());
 		}
-		return std::move(*ptr);
 	}
 }  // namespace LLU
 
@@ -6,14 +6,21 @@
 #ifndef LLU_CONTAINERS_GENERIC_DATAVECTOR_HPP
 #define LLU_CONTAINERS_GENERIC_DATAVECTOR_HPP
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
 #include <numeric>
 #include <span>
+#include <string>
 #include <string_view>
 #include <variant>
+#include <vector>
 
 #include "LLU/Containers/Generic/Base.hpp"
 #include "LLU/Containers/Generic/NumericArray.hpp"
 #include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/ValidityBitmap.h"
 #include "LLU/Containers/Views/NumericArray.hpp"
 #include "LLU/UniquePtr.h"
 
@@ -66,6 +73,9 @@ namespace LLU {
 
 		using Data = std::variant<NumericData, StringData, Int8Array, BinaryData, FixedWidthBinaryData, DateData, TimeData>;
 
+		/// Get the name of a DataVector type
+		std::string typeName(Type t);
+
 		template<typename T>
 		UniquePtr<mint[]> lengthsToOffsets(std::span<T> lengths) {
 			const auto elem_count = lengths.size();
@@ -75,22 +85,56 @@ namespace LLU {
 			return offsets;
 		}
 
+		namespace Detail {
+			/**
+			 * @brief   Get a buffer that LibraryLink can take ownership of.
+			 * @details Buffers allocated with the LibraryLink allocator are passed through without copies. Other buffers are copied in a single block
+			 *          because LibraryLink always releases buffers it owns with WL_free, and then released with their own deleter.
+			 * @param   buffer - owned buffer with arbitrary deleter
+			 * @param   count - number of elements in the buffer
+			 */
+			template<typename T, typename D>
+			UniquePtr<std::remove_const_t<T>[]> toLibraryBuffer(std::unique_ptr<T[], D>&& buffer, std::size_t count) {
+				using U = std::remove_const_t<T>;
+				if constexpr (std::is_same_v<D, detail::Deleter<T[]>> || std::is_same_v<D, detail::Deleter<U[]>>) {
+					return UniquePtr<U[]> {const_cast<U*>(buffer.release())};
+				} else {
+					auto result = makeUnique<U[]>(std::max<std::size_t>(count, 1));
+					if (count > 0) {
+						std::memcpy(result.get(), buffer.get(), count * sizeof(U));
+					}
+					buffer.reset();
+					return result;
+				}
+			}
+		}  // namespace Detail
+
+		/**
+		 * @brief   Build a validity array that marks non-finite values (Infinity, NaN) of a NumericArray as missing.
+		 * @param   array - typed view of the NumericArray
+		 * @return  validity array with 0 at positions of non-finite values, or an empty array if all values are finite (i.e. nothing is missing)
+		 */
 		template<typename T>
 		Int8Array exceptionalValuesAsMissing(const NumericArrayTypedView<T>& array) {
 			if constexpr (std::is_floating_point_v<T>) {
+				// the bitmap does not allocate until the first exceptional value, so columns without them get an empty validity array
 				const auto elem_count = array.getFlattenedLength();
-				Int8Array validity {static_cast<std::uint8_t>(true), MArrayDimensions {elem_count}};
+				ValidityBitmap validity;
+				validity.reserve(static_cast<std::size_t>(elem_count));
 				for (mint i = 0; i < elem_count; ++i) {
-					if (std::isinf(array[i]) || std::isnan(array[i])) {
-						validity[i] = 0;
-					}
+					validity.append(std::isfinite(array[i]));
 				}
-				return validity;
+				return validity.toInt8Array();
 			} else {
 				return {};
 			}
 		}
 
+		/**
+		 * @brief   Build a validity array that marks non-finite values (Infinity, NaN) of a NumericArray as missing.
+		 * @param   array - generic NumericArray
+		 * @return  validity array with 0 at positions of non-finite values, or an empty array if all values are finite (i.e. nothing is missing)
+		 */
 		Int8Array exceptionalValuesAsMissing(const GenericNumericArray& array);
 	}
 
@@ -133,6 +177,38 @@ namespace LLU {
 		 */
 		MContainer(mint str_count, UniquePtr<const char>&& string_data, UniquePtr<mint[]>&& offsets, const Int8Array& validity = {});
 
+		/**
+		 * Create a new DataVector of string type from an owned contiguous buffer of characters and an owned offset array
+		 * @tparam  C - character type, either char or const char
+		 * @tparam  CharDeleter - deleter of the character buffer
+		 * @tparam  OffsetDeleter - deleter of the offset array
+		 * @param   str_count - number of data elements
+		 * @param   string_data - contiguous buffer of characters of all strings, ownership passed to the DataVector
+		 * @param   offsets - array of str_count + 1 offsets of strings in \p string_data, ownership passed to the DataVector
+		 * @param   validity - missing values array
+		 * @note    Buffers allocated with LLU::makeUnique are passed to the DataVector without copies. Buffers with other deleters are copied once
+		 *          as a whole, because LibraryLink releases the memory it owns with WL_free.
+		 */
+		template<typename C, typename CharDeleter, typename OffsetDeleter>
+			requires std::is_same_v<std::remove_const_t<C>, char>
+		MContainer(mint str_count, std::unique_ptr<C[], CharDeleter>&& string_data, std::unique_ptr<mint[], OffsetDeleter>&& offsets,
+				   const Int8Array& validity = {}) {
+			auto lib_offsets = DV::Detail::toLibraryBuffer(std::move(offsets), static_cast<std::size_t>(str_count + 1));
+			const auto char_count = static_cast<std::size_t>(lib_offsets[static_cast<std::size_t>(str_count)]);
+			auto lib_chars = DV::Detail::toLibraryBuffer(std::move(string_data), char_count);
+			createString(str_count, lib_chars.release(), lib_offsets.release(), validity);
+		}
+
+		/**
+		 * Create a new DataVector of string type from a contiguous block of characters and offsets that the DataVector does not own.
+		 * Both are copied in a single block each, so the individual strings are never visited.
+		 * @param   characters - characters of all strings
+		 * @param   offsets - str_count + 1 offsets of strings in \p characters
+		 * @param   validity - missing values array
+		 * @throws  ErrorName::DVConstructorType - if \p offsets is empty, does not start with 0, decreases or points past the end of \p characters
+		 */
+		MContainer(std::string_view characters, std::span<const mint> offsets, const Int8Array& validity = {});
+
 		/**
 		 * Create a new DataVector of string type from a vector of string views
 		 * @param string_data
@@ -205,10 +281,16 @@ namespace LLU {
 		/// Get the validity array (for each element: 0 -> missing, 1 -> present)
 		Int8Array validity() const;
 
+		/// Get the validity as a bitmap, without fetching the validity array if no element is missing
+		DV::ValidityBitmap validityBitmap() const;
+
 		/// See the underlying data without making any copies
-		DV::Data viewData();
+		DV::Data viewData() const;
 
 	private:
+		/// Create a string TabularColumn taking ownership of the buffers allocated with WL_malloc
+		void createString(mint str_count, const char* string_data, mint* offsets, const Int8Array& validity);
+
 		/// Make a deep copy of the raw container
 		Container cloneImpl() const override;
 
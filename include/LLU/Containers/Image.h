@@ -16,6 +16,8 @@
 
 namespace LLU {
 
+	class MArgumentManager;
+
 	/**
 	 *  @brief  Typed interface for Image.
 	 *
@@ -192,8 +194,13 @@ namespace LLU {
 		Image<U> convert() const;
 
 	private:
+		friend class MArgumentManager;
+
 		using GenericBase = GenericImage;
 
+		/// Wrap a generic Image whose element type is known to be T, without querying the type again
+		Image(GenericBase im, TypeCheckedTag) : TypedImage<T>(dimensionsFromGenericImage(im)), GenericBase(std::move(im)) {}
+
 		/// @copydoc MContainerBase::getContainer()
 		MImage getInternal() const noexcept override {
 			return this->getContainer();
@@ -216,7 +223,7 @@ namespace LLU {
 	Image<T>::Image(mint w, mint h, mint channels, colorspace_t cs, bool interleavingQ) : Image(0, w, h, channels, cs, interleavingQ) {}
 
 	template<typename T>
-	Image<T>::Image(GenericBase im) : TypedImage<T>(dimensionsFromGenericImage(im)), GenericBase(std::move(im)) {
+	Image<T>::Image(GenericBase im) : Image(std::move(im), TypeCheckedTag {}) {
 		if (ImageType<T> != GenericBase::type()) {
 			ErrorManager::throwException(ErrorName::ImageTypeError);
 		}
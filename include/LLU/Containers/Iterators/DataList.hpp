@@ -189,12 +189,7 @@ namespace LLU {
 		 */
 		template<typename U>
 		U as() const {
-			auto v = node.value();
-			auto* ptr = std::get_if<U>(std::addressof(v));
-			if (!ptr) {
-				ErrorManager::throwException(ErrorName::DLInvalidNodeType);
-			}
-			return std::move(*ptr);
+			return node.as<U>();
 		}
 	};
 
@@ -47,9 +47,16 @@ namespace LLU {
 		 */
 		[[nodiscard]] Argument::TypedArgument value() const;
 
+		/**
+		 * Get value of the node as plain MArgument, without any conversion
+		 * @return MArgument whose active member is described by type()
+		 */
+		[[nodiscard]] MArgument rawValue() const;
+
 		// defined in Containers/Generic/DataStore.hpp because the definition of GenericDataList must be available
 		/**
 		 * Get node value if it is of type T, otherwise throw an exception.
+		 * The value is read directly from the node, the TypedArgument variant is only constructed when T is NodeType::Any.
 		 * @tparam T - any type from LLU::NodeType namespace
 		 * @return node value of type T
 		 */
@@ -22,6 +22,9 @@
 
 namespace LLU {
 
+	/// Tag for constructors of NumericArray, Tensor and Image which wrap a generic container whose element type is already known to match
+	struct TypeCheckedTag {};
+
 	/**
 	 * @class MArray
 	 * @brief This is a class template, where template parameter T is the type of data elements. MArray is the base class for NumericArray, Tensor and Image.
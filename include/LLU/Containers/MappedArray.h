@@ -0,0 +1,206 @@
+/**
+ * @file	MappedArray.h
+ * @date	October 19, 2026
+ * @brief	Definition of MappedFile and MappedArray - read-only, memory-mapped views of numeric data stored in files.
+ */
+#ifndef LLU_CONTAINERS_MAPPEDARRAY_H
+#define LLU_CONTAINERS_MAPPEDARRAY_H
+
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+#include "LLU/Containers/Interfaces.h"
+#include "LLU/Containers/Iterators/IterableContainer.hpp"
+#include "LLU/Containers/MArrayDimensions.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/Tensor.h"
+
+namespace LLU {
+
+	/// Expected access pattern of a memory-mapped region, passed to the operating system as a hint
+	enum class MappedAccess {
+		Normal,		   ///< No special treatment
+		Sequential,	   ///< Pages will be accessed in order, so aggressive read-ahead pays off
+		Random,		   ///< Pages will be accessed in random order, so read-ahead is wasteful
+		WillNeed,	   ///< The whole region will be needed soon, so it can be read ahead of time
+		DontNeed	   ///< The region will not be needed soon, so its pages can be dropped from the process
+	};
+
+	/**
+	 * @class   MappedFile
+	 * @brief   Read-only memory mapping of a region of a file.
+	 * @details The mapping is shared, so processes that map the same file share its pages in the page cache. The file path is checked with
+	 *          validatePath() before the file is opened, just like in openFile(). MappedFile is movable but not copyable.
+	 */
+	class MappedFile {
+	public:
+		/// Create an empty MappedFile that does not map anything
+		MappedFile() = default;
+
+		/**
+		 * @brief   Map a region of a file into memory for reading.
+		 * @param   fileName - path to the file
+		 * @param   offset - position in the file where the region starts, in bytes
+		 * @param   length - length of the region in bytes, by default the region extends to the end of the file
+		 * @throws  ErrorName::PathNotValidated - if the path cannot be validated for reading
+		 * @throws  ErrorName::OpenFileFailed - if the file cannot be opened
+		 * @throws  ErrorName::MapFileFailed - if the region does not fit in the file or the system call fails
+		 */
+		explicit MappedFile(const std::string& fileName, std::size_t offset = 0, std::optional<std::size_t> length = std::nullopt);
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+		/// Unmap the region
+		~MappedFile();
+
+		/// Get the first byte of the region
+		[[nodiscard]] const std::byte* data() const noexcept {
+			return regionBegin;
+		}
+
+		/// Get the length of the region in bytes
+		[[nodiscard]] std::size_t size() const noexcept {
+			return regionLength;
+		}
+
+		/**
+		 * @brief   Tell the operating system how the region is going to be accessed. The hint may be ignored on some platforms.
+		 * @param   access - expected access pattern
+		 */
+		void advise(MappedAccess access) const noexcept;
+
+	private:
+		/// Release the mapping and reset all members
+		void unmap() noexcept;
+
+		/// Start of the mapping, aligned to the page size
+		void* mapping = nullptr;
+
+		/// Length of the whole mapping, which may start up to one page before the region
+		std::size_t mappingLength = 0;
+
+		/// First byte of the requested region
+		const std::byte* regionBegin = nullptr;
+
+		/// Length of the requested region
+		std::size_t regionLength = 0;
+	};
+
+	/**
+	 * @class   MappedArray
+	 * @brief   Read-only view of a file region holding a flat array of elements of type T, in the native byte order and in row-major order.
+	 * @details MappedArray implements NumericArrayInterface and provides the same iterators as NumericArrayTypedView, so code written against those
+	 *          interfaces can read a file without loading it first. Pages are read from the disk when they are first accessed. A NumericArray (or a
+	 *          Tensor) is only created when toNumericArray() (or toTensor()) is called, in which case data is copied once, directly from the
+	 *          mapped pages.
+	 * @tparam  T - type of the elements, must be one of the NumericArray data types
+	 * @warning Data must not be modified through the pointer returned by rawData(), because the pages are mapped read-only.
+	 */
+	template<typename T>
+	class MappedArray : public NumericArrayInterface, public IterableContainer<const T> {
+	public:
+		/// Create an empty MappedArray
+		MappedArray() = default;
+
+		/**
+		 * @brief   Map an array of given dimensions starting at \p offset bytes from the beginning of the file.
+		 * @param   fileName - path to the file
+		 * @param   dims - dimensions of the array
+		 * @param   offset - position of the first element in the file, in bytes, must be a multiple of alignof(T)
+		 * @throws  see MappedFile::MappedFile
+		 */
+		MappedArray(const std::string& fileName, MArrayDimensions dims, std::size_t offset = 0)
+			: dimensions {std::move(dims)}, file {fileName, checkedOffset(fileName, offset), static_cast<std::size_t>(dimensions.flatCount()) * sizeof(T)} {}
+
+		/**
+		 * @brief   Map a one-dimensional array of all the elements from \p offset to the end of the file.
+		 * @details Trailing bytes which do not make up a whole element are not part of the array.
+		 * @param   fileName - path to the file
+		 * @param   offset - position of the first element in the file, in bytes, must be a multiple of alignof(T)
+		 * @throws  see MappedFile::MappedFile
+		 */
+		explicit MappedArray(const std::string& fileName, std::size_t offset = 0) : file {fileName, checkedOffset(fileName, offset)} {
+			dimensions = MArrayDimensions {static_cast<mint>(file.size() / sizeof(T))};
+		}
+
+		/// @copydoc NumericArrayInterface::getRank()
+		mint getRank() const override {
+			return dimensions.rank();
+		}
+
+		/// @copydoc NumericArrayInterface::getDimensions()
+		mint const* getDimensions() const override {
+			return dimensions.data();
+		}
+
+		/// @copydoc NumericArrayInterface::getFlattenedLength()
+		mint getFlattenedLength() const override {
+			return dimensions.flatCount();
+		}
+
+		/// @copydoc NumericArrayInterface::type()
+		numericarray_data_t type() const override {
+			return NumericArrayType<T>;
+		}
+
+		/// @copydoc NumericArrayInterface::rawData()
+		void* rawData() const override {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): the interface requires a non-const pointer, see the warning in class description
+			return const_cast<T*>(getData());
+		}
+
+		/// Get the dimensions of the array
+		[[nodiscard]] const MArrayDimensions& getMArrayDimensions() const noexcept {
+			return dimensions;
+		}
+
+		/// @copydoc MappedFile::advise
+		void advise(MappedAccess access) const noexcept {
+			file.advise(access);
+		}
+
+		/// Copy the data into a new NumericArray of the same dimensions
+		[[nodiscard]] NumericArray<T> toNumericArray() const {
+			return NumericArray<T> {this->cbegin(), this->cend(), dimensions};
+		}
+
+		/// Copy the data into a new Tensor of the same dimensions, only available for element types supported by Tensor
+		[[nodiscard]] Tensor<T> toTensor() const
+			requires(std::is_same_v<T, mint> || std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>)
+		{
+			return Tensor<T> {this->cbegin(), this->cend(), dimensions};
+		}
+
+	private:
+		/// Check that elements at \p offset are properly aligned for type T
+		static std::size_t checkedOffset(const std::string& fileName, std::size_t offset) {
+			if (offset % alignof(T) != 0) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, "Offset is not aligned for the element type", fileName);
+			}
+			return offset;
+		}
+
+		const T* getData() const noexcept override {
+			return reinterpret_cast<const T*>(file.data());	   // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast): the file stores values of type T
+		}
+
+		mint getSize() const noexcept override {
+			return dimensions.flatCount();
+		}
+
+		/// Dimensions of the array
+		MArrayDimensions dimensions;
+
+		/// Mapped region of the file
+		MappedFile file;
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_CONTAINERS_MAPPEDARRAY_H
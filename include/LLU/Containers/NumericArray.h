@@ -19,6 +19,8 @@
 
 namespace LLU {
 
+	class MArgumentManager;
+
 	/**
 	 *  @brief  Typed interface for NumericArray.
 	 *
@@ -150,8 +152,13 @@ namespace LLU {
 		}
 
 	private:
+		friend class MArgumentManager;
+
 		using GenericBase = GenericNumericArray;
 
+		/// Wrap a generic NumericArray whose element type is known to be T, without querying the type again
+		NumericArray(GenericBase na, TypeCheckedTag) : TypedNumericArray<T>({na.getDimensions(), na.getRank()}), GenericBase(std::move(na)) {}
+
 		MNumericArray getInternal() const noexcept override {
 			return this->getContainer();
 		}
@@ -181,7 +188,7 @@ namespace LLU {
 	}
 
 	template<typename T>
-	NumericArray<T>::NumericArray(GenericBase na) : TypedNumericArray<T>({na.getDimensions(), na.getRank()}), GenericBase(std::move(na)) {
+	NumericArray<T>::NumericArray(GenericBase na) : NumericArray(std::move(na), TypeCheckedTag {}) {
 		if (NumericArrayType<T> != GenericBase::type()) {
 			ErrorManager::throwException(ErrorName::NumericArrayTypeError);
 		}
@@ -19,6 +19,8 @@
 
 namespace LLU {
 
+	class MArgumentManager;
+
 	/**
 	 *  @brief  Typed interface for Tensor.
 	 *
@@ -138,8 +140,13 @@ namespace LLU {
 			return Tensor {cloneContainer(), Ownership::Library};
 		}
 	private:
+		friend class MArgumentManager;
+
 		using GenericBase = MContainer<MArgumentType::Tensor>;
 
+		/// Wrap a generic Tensor whose element type is known to be T, without querying the type again
+		Tensor(GenericBase t, TypeCheckedTag) : TypedTensor<T>({t.getDimensions(), t.getRank()}), GenericBase(std::move(t)) {}
+
 		/// @copydoc MContainerBase::getContainer()
 		MTensor getInternal() const noexcept override {
 			return this->getContainer();
@@ -170,7 +177,7 @@ namespace LLU {
 	}
 
 	template<typename T>
-	Tensor<T>::Tensor(GenericBase t) : TypedTensor<T>({t.getDimensions(), t.getRank()}), GenericBase(std::move(t)) {
+	Tensor<T>::Tensor(GenericBase t) : Tensor(std::move(t), TypeCheckedTag {}) {
 		if (TensorType<T> != GenericBase::type()) {
 			ErrorManager::throwException(ErrorName::TensorTypeError);
 		}
@@ -0,0 +1,144 @@
+/**
+ * @file	ValidityBitmap.h
+ * @date	October 19, 2026
+ * @brief	Definition of ValidityBitmap - bit-packed mask of missing elements of a DataVector.
+ */
+#ifndef LLU_CONTAINERS_VALIDITYBITMAP_H
+#define LLU_CONTAINERS_VALIDITYBITMAP_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "LLU/Containers/NumericArray.h"
+
+namespace LLU::DV {
+
+	/**
+	 * @class   ValidityBitmap
+	 * @brief   Validity of DataVector elements stored with one bit per element, where 1 means present and 0 means missing.
+	 * @details A bitmap in which all elements are present does not allocate any memory. The byte-per-element Int8Array used by LibraryLink is only
+	 *          created when the bitmap is passed to a DataVector, see toInt8Array().
+	 */
+	class ValidityBitmap {
+	public:
+		/// Number of bits in a single word of the bitmap
+		static constexpr std::size_t WordBits = 64;
+
+		/// Create an empty bitmap
+		ValidityBitmap() = default;
+
+		/**
+		 * @brief   Create a bitmap of given length with all elements present or all elements missing
+		 * @param   length - number of elements
+		 * @param   valid - whether the elements are present
+		 */
+		explicit ValidityBitmap(std::size_t length, bool valid = true);
+
+		/**
+		 * @brief   Create a bitmap from a byte-per-element validity array
+		 * @param   mask - Int8Array with 0 for missing elements and any other value for present ones
+		 */
+		explicit ValidityBitmap(const Int8Array& mask);
+
+		/// Get the number of elements as std::size_t
+		[[nodiscard]] std::size_t size() const noexcept {
+			return len;
+		}
+
+		/// Get the number of elements as mint
+		[[nodiscard]] mint length() const noexcept {
+			return static_cast<mint>(len);
+		}
+
+		/// Get the number of missing elements
+		[[nodiscard]] mint missingCount() const noexcept {
+			return missing;
+		}
+
+		/// Check if no element is missing, in which case the bitmap does not hold any memory
+		[[nodiscard]] bool allValid() const noexcept {
+			return bits.empty();
+		}
+
+		/// Check if the element at given position is present. The index is not checked.
+		bool operator[](std::size_t i) const noexcept {
+			return bits.empty() || ((bits[i / WordBits] >> (i % WordBits)) & 1U) != 0;
+		}
+
+		/// Get the words of the bitmap, empty if all elements are present. Bits past the length are always 0.
+		[[nodiscard]] std::span<const std::uint64_t> words() const noexcept {
+			return bits;
+		}
+
+		/**
+		 * @brief   Reserve space for at least \p n elements, used when the bitmap grows with append()
+		 * @param   n - expected number of elements
+		 */
+		void reserve(std::size_t n);
+
+		/**
+		 * @brief   Append validity of \p count consecutive elements
+		 * @param   valid - whether the elements are present
+		 * @param   count - number of elements
+		 */
+		void append(bool valid, std::size_t count = 1);
+
+		/**
+		 * @brief   Set validity of a single element. The index is not checked.
+		 * @param   i - position of the element
+		 * @param   valid - whether the element is present
+		 */
+		void set(std::size_t i, bool valid);
+
+		/**
+		 * @brief   Mark as missing each element which is missing in \p other
+		 * @throws  ErrorName::DVLengthMismatch - if the bitmaps have different lengths
+		 */
+		ValidityBitmap& operator&=(const ValidityBitmap& other);
+
+		/**
+		 * @brief   Mark as present each element which is present in \p other
+		 * @throws  ErrorName::DVLengthMismatch - if the bitmaps have different lengths
+		 */
+		ValidityBitmap& operator|=(const ValidityBitmap& other);
+
+		/// Element is present in the result if it is present in both bitmaps
+		friend ValidityBitmap operator&(ValidityBitmap lhs, const ValidityBitmap& rhs) {
+			return lhs &= rhs;
+		}
+
+		/// Element is present in the result if it is present in any of the bitmaps
+		friend ValidityBitmap operator|(ValidityBitmap lhs, const ValidityBitmap& rhs) {
+			return lhs |= rhs;
+		}
+
+		/**
+		 * @brief   Convert to the byte-per-element validity array that DataVector constructors accept
+		 * @return  Int8Array with 1 for present and 0 for missing elements, or an empty Int8Array if no element is missing
+		 */
+		[[nodiscard]] Int8Array toInt8Array() const;
+
+	private:
+		/// Allocate words with bits [0, len) set, so that missing elements can be tracked
+		void materialize();
+
+		/// Recount missing elements and release the words if none is missing
+		void normalize();
+
+		/// Bits of the mask, empty as long as no element is missing
+		std::vector<std::uint64_t> bits;
+
+		/// Number of elements
+		std::size_t len = 0;
+
+		/// Number of missing elements
+		mint missing = 0;
+
+		/// Number of elements the caller reserved space for
+		std::size_t reserved = 0;
+	};
+
+}  // namespace LLU::DV
+
+#endif	  // LLU_CONTAINERS_VALIDITYBITMAP_H
@@ -57,12 +57,13 @@ namespace LLU {
 		extern const std::string ErrorManagerCreateNameError;	 ///< trying to register exception with already existing name
 
 		// NumericArray errors:
-		extern const std::string NumericArrayNewError;			 ///< creating new NumericArray failed
-		extern const std::string NumericArrayCloneError;		 ///< NumericArray cloning failed
-		extern const std::string NumericArrayTypeError;			 ///< NumericArray type mismatch
-		extern const std::string NumericArraySizeError;			 ///< wrong assumption about NumericArray size
-		extern const std::string NumericArrayIndexError;		 ///< trying to access non-existing element
-		extern const std::string NumericArrayConversionError;	 ///< conversion from NumericArray of different type failed
+		extern const std::string NumericArrayNewError;				///< creating new NumericArray failed
+		extern const std::string NumericArrayCloneError;			///< NumericArray cloning failed
+		extern const std::string NumericArrayTypeError;				///< NumericArray type mismatch
+		extern const std::string NumericArraySizeError;				///< wrong assumption about NumericArray size
+		extern const std::string NumericArrayIndexError;			///< trying to access non-existing element
+		extern const std::string NumericArrayConversionError;		///< conversion from NumericArray of different type failed
+		extern const std::string NumericArrayDecompressionError;	///< compressed NumericArray data is corrupted
 
 		// MTensor errors:
 		extern const std::string TensorNewError;	  ///< creating new MTensor failed
@@ -125,6 +126,9 @@ namespace LLU {
 		extern const std::string DLGetNodeDataError;	 ///< DataStoreNode_getData failed
 		extern const std::string DLSharedDataStore;	 	 ///< Trying to create a Shared DataStore. DataStore can only be passed as Automatic or Manual.
 		extern const std::string DLPushBackTypeError;	 ///< Element to be added to the DataList has incorrect type
+		extern const std::string DLIndexError;			 ///< Node index is out of range of the DataList
+		extern const std::string DLNameNotFound;		 ///< There is no node with given name in the DataList
+		extern const std::string DLRangeSizeMismatch;	 ///< Ranges of node names and node values have different lengths
 
 		// MArgument errors:
 		extern const std::string ArgumentCreateNull;		  ///< Trying to create PrimitiveWrapper object from nullptr
@@ -142,11 +146,24 @@ namespace LLU {
 		extern const std::string PathNotValidated;		///< Given file path could not be validated under desired open mode
 		extern const std::string InvalidOpenMode;		///< Specified open mode is invalid
 		extern const std::string OpenFileFailed;		///< Could not open file
+		extern const std::string MapFileFailed;			///< Could not map a region of a file into memory
+		extern const std::string FileReadFailed;		///< Reading from a file failed
+		extern const std::string FileWriteFailed;		///< Writing to a file failed
+		extern const std::string InvalidUTFSequence;	///< String is not valid UTF-8, UTF-16 or UTF-32
+		extern const std::string UTFBufferTooSmall;		///< Output buffer of a UTF conversion is too small
+		extern const std::string InvalidSnapshot;		///< File is not a valid snapshot
+		extern const std::string SnapshotEntryNotFound;	///< Snapshot does not contain an entry with given name
+		extern const std::string SnapshotEntryType;		///< Snapshot entry is not of the requested type
+		extern const std::string SnapshotEntryCompressed;	///< Snapshot entry is compressed and cannot be mapped into memory
 
 		// TabularColumn errors:
 		extern const std::string DVShared;	 	 	///< Trying to create a Shared TabularColumn. TabularColumn can only be passed as Automatic or Manual.
 		extern const std::string DVAPIError;	 	///< TabularColumn LibraryLink API returned error.
 		extern const std::string DVConstructorType; ///< TabularColumn types passed to the constructor does not match other arguments.
+		extern const std::string DVIndexError;		///< Row index is out of range for a TabularColumn.
+		extern const std::string DVKernelType;		///< Column operation is not supported for the TabularColumn type.
+		extern const std::string DVLengthMismatch;	///< Lengths of TabularColumns used in a single operation do not match.
+		extern const std::string DVDictionaryFull;	///< Number of distinct values in a dictionary-encoded column exceeds the range of codes.
 
 		// BitVector errors:
 		extern const std::string BitVectorNew;      ///< Could not create a new BitVector.
@@ -6,14 +6,14 @@
 #ifndef LLU_FILEUTILITIES_H
 #define LLU_FILEUTILITIES_H
 
-#include <codecvt>
 #include <cstdio>
 #include <fstream>
 #include <ios>
-#include <locale>
 #include <memory>
 #include <string>
 
+#include "LLU/UTFConversion.h"
+
 namespace LLU {
 	/// Smart pointer type around std::FILE
 	using FilePtr = std::unique_ptr<std::FILE, int (*)(std::FILE*)>;
@@ -33,98 +33,6 @@ namespace LLU {
 	 */
 	void validatePath(const std::string& fileName, std::ios::openmode mode);
 
-	/**
-	 * Convert string from UTF8 to UTF16.
-	 * @tparam	T - character type for the result, supported types are char16_t, char32_t, or wchar_t
-	 * @param	source - string in UTF8 encoding
-	 * @return  copy of the input string converted to UTF16
-	 * @note    char16_t and char32_t strings on Windows will be converted to a temporary std::wstring first due to a bug in VS2017
-	 */
-	template<typename T>
-	std::basic_string<T> fromUTF8toUTF16(const std::string& source) {
-#ifdef _WIN32
-		// On Windows with VS2017 only conversion to wchar_t is supported, so we have no choice here
-		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> convertor;
-		if constexpr (!std::is_same_v<T, wchar_t>) {
-			std::wstring tmp = convertor.from_bytes(source);
-			return std::basic_string<T> { std::begin(tmp), std::end(tmp) };
-		} else {
-			return convertor.from_bytes(source);
-		}
-#else
-		std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
-		return convertor.from_bytes(source);
-#endif
-	}
-
-	/**
-	 * Convert string from UTF16 to UTF8.
-	 * @tparam  T - character type of the UTF16 string, supported types are char16_t, char32_t, or wchar_t
-	 * @param   source - string in UTF16 encoding
-	 * @return  copy of the input string converted to UTF8
-	 * @note    char16_t and char32_t strings on Windows will be converted to std::wstring before encoding conversion due to a bug in VS2017
-	 */
-	template<typename T>
-	std::string fromUTF16toUTF8(const std::basic_string<T>& source) {
-#ifdef _WIN32
-		// On Windows with VS2017 only conversion from wchar_t is supported, so we have no choice here
-		std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>, wchar_t> convertor;
-		if constexpr (!std::is_same_v<T, wchar_t>) {
-			return convertor.to_bytes(std::wstring { std::begin(source), std::end(source) });
-		} else {
-			return convertor.to_bytes(source);
-		}
-#else
-		std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
-		return convertor.to_bytes(source);
-#endif
-	}
-
-	/**
-	 * Convert string from UTF8 to UTF32.
-	 * @tparam  T - character type for the result
-	 * @param   source - string in UTF8 encoding
-	 * @return  copy of the input string converted to UTF32
-	 */
-	template<typename T>
-	std::basic_string<T> fromUTF8toUTF32(const std::string& source) {
-#ifdef _WIN32
-		// On Windows with VS2017 we always convert to uint32_t
-		std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convertor;
-		if constexpr (!std::is_same_v<T, uint32_t>) {
-			std::basic_string<uint32_t> tmp = convertor.from_bytes(source);
-			return std::basic_string<T> { std::begin(tmp), std::end(tmp) };
-		} else {
-			return convertor.from_bytes(source);
-		}
-#else
-		std::wstring_convert<std::codecvt_utf8<T>, T> convertor;
-		return convertor.from_bytes(source);
-#endif
-	}
-
-	/**
-	 * Convert string from UTF32 to UTF8.
-	 * @tparam  T - character type of the UTF32 string
-	 * @param   source - string in UTF32 encoding
-	 * @return  copy of the input string converted to UTF8
-	 */
-	template<typename T>
-	std::string fromUTF32toUTF8(const std::basic_string<T>& source) {
-#ifdef _WIN32
-		// On Windows with VS2017 we always convert from uint32_t
-		std::wstring_convert<std::codecvt_utf8<uint32_t>, uint32_t> convertor;
-		if constexpr (!std::is_same_v<T, uint32_t>) {
-			return convertor.to_bytes(std::basic_string<uint32_t> { std::begin(source), std::end(source) });
-		} else {
-			return convertor.to_bytes(source);
-		}
-#else
-		std::wstring_convert<std::codecvt_utf8<T>, T> convertor;
-		return convertor.to_bytes(source.data());
-#endif
-	}
-
 	/**
 	 * @brief   Base class for shared access policies on Windows.
 	 * @details Library users are encouraged to provide their own derived classes if needed.
@@ -11,11 +11,16 @@
 
 /* Containers */
 #include "LLU/Containers/DataList.h"
+#include "LLU/Containers/DataVectorBuilder.h"
+#include "LLU/Containers/DataVectorKernels.h"
+#include "LLU/Containers/DictionaryColumn.h"
 #include "LLU/Containers/Generic/DataVector.hpp"
 #include "LLU/Containers/Image.h"
+#include "LLU/Containers/MappedArray.h"
 #include "LLU/Containers/NumericArray.h"
 #include "LLU/Containers/SparseArray.h"
 #include "LLU/Containers/Tensor.h"
+#include "LLU/Containers/ValidityBitmap.h"
 #include "LLU/Containers/Views/Image.hpp"
 #include "LLU/Containers/Views/NumericArray.hpp"
 
@@ -25,11 +30,17 @@
 
 /* Library function arguments */
 #include "LLU/MArgumentManager.h"
+#include "LLU/TypedFunction.h"
 
 /* WSTP */
 #include "LLU/WSTP/WSStream.hpp"
 
 /* Others */
+#include "LLU/AsyncFile.h"
+#include "LLU/ChunkReader.h"
+#include "LLU/Compression.h"
+#include "LLU/CSVReader.h"
 #include "LLU/FileUtilities.h"
+#include "LLU/Snapshot.h"
 
 #endif // LLU_LLU_H
@@ -57,6 +57,47 @@
 	}                                                                   \
 	void impl_##name(LLU::MArgumentManager& mngr)
 
+/**
+ * @brief   This macro defines a LibraryLink function that calls a regular C++ function with native parameter and return types.
+ * @details LLU_TYPED_FUNCTION(MyFunction, double(const LLU::Tensor<double>&, mint)) declares a function impl_MyFunction of the given type, which you need
+ * to define, and a LibraryLink function MyFunction, which checks the number of arguments once, reads every argument at its position with its type known
+ * at compile time and sets the value returned from impl_MyFunction as the result. Errors are handled the same way as in LLU_LIBRARY_FUNCTION.
+ *
+ * Supported parameter and return types are listed in LLU::FunctionArgument. The macro also defines a LibraryLink function MyFunction_LLUSignature,
+ * which returns the matching LibraryFunctionLoad signature, so the function can be loaded in the Wolfram Language with `LLU`TypedFunctionSet
+ * without repeating its type.
+ *
+ * Use LLU_LISTABLE_TYPED_FUNCTION instead if the function should also be callable on lists of arguments.
+ *
+ * @note    Typed functions do not support the "ProgressMonitor" option, use LLU_LIBRARY_FUNCTION if you need it.
+ */
+#define LLU_TYPED_FUNCTION(name, ...)                                                         \
+	std::type_identity_t<__VA_ARGS__> impl_##name; /* forward declaration */                  \
+	LIBRARY_LINK_FUNCTION(name) {                                                             \
+		return LLU::TypedFunction<__VA_ARGS__>::call<impl_##name>(libData, Argc, Args, Res);  \
+	}                                                                                         \
+	EXTERN_C DLLEXPORT int name##_LLUSignature(WolframLibraryData, mint, MArgument*, MArgument); \
+	int name##_LLUSignature(WolframLibraryData, mint, MArgument*, MArgument Res) {             \
+		return LLU::TypedFunction<__VA_ARGS__>::signatureFunction(Res);                       \
+	}
+
+/**
+ * @brief   This macro defines a typed library function (see LLU_TYPED_FUNCTION) which can also be called on lists of arguments.
+ * @details All parameters and the result must be scalars (Booleans, integers, reals or complex numbers), or the result can be void, which is checked
+ * at compile time. In addition to what LLU_TYPED_FUNCTION defines, the macro defines LibraryLink functions MyFunction_LLUListable, which takes
+ * every parameter as a Tensor, and MyFunction_LLUListableNumericArray, which takes every parameter as a NumericArray. Both evaluate impl_MyFunction
+ * for all rows of arguments in a single call, optionally on several threads, and they are used when the function is loaded in the Wolfram Language
+ * with the option "Listable" -> True. See LLU::TypedFunction::callListable for details.
+ */
+#define LLU_LISTABLE_TYPED_FUNCTION(name, ...)                                                                 \
+	LLU_TYPED_FUNCTION(name, __VA_ARGS__)                                                                      \
+	LIBRARY_LINK_FUNCTION(name##_LLUListable) {                                                                \
+		return LLU::TypedFunction<__VA_ARGS__>::callListable<impl_##name>(libData, Argc, Args, Res);           \
+	}                                                                                                          \
+	LIBRARY_LINK_FUNCTION(name##_LLUListableNumericArray) {                                                    \
+		return LLU::TypedFunction<__VA_ARGS__>::callListable<impl_##name, true>(libData, Argc, Args, Res);     \
+	}
+
 #define LLU_WSTP_FUNCTION(name)                                \
 	void impl_##name(WSLINK&); /* forward declaration */       \
 	LIBRARY_WSTP_FUNCTION(name) {                              \
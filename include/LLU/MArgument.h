@@ -8,7 +8,9 @@
 #ifndef LLU_MARGUMENT_H
 #define LLU_MARGUMENT_H
 
+#include <span>
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include "LLU/LibraryData.h"
@@ -143,6 +145,23 @@ namespace LLU {
 		 */
 		static void addDataStoreNode(DataStore ds, value_type val);
 
+		/**
+		 * @brief 	Add all values from \c vals to the DataStore \c ds, each inside a new unnamed node
+		 * The DataStore API is looked up only once, which makes this function much faster than repeated calls to addDataStoreNode.
+		 * @param 	ds - DataStore with values of type T
+		 * @param 	vals - values of the new nodes in the DataStore
+		 */
+		static void addDataStoreNodes(DataStore ds, std::span<const value_type> vals);
+
+		/**
+		 * @brief 	Add all values from \c vals to the DataStore \c ds, each inside a new node named with the corresponding element of \c names
+		 * The DataStore API is looked up only once, which makes this function much faster than repeated calls to addDataStoreNode.
+		 * @param 	ds - DataStore with values of type T
+		 * @param 	names - names for the new nodes, must be null-terminated and there must be at least as many names as values
+		 * @param 	vals - values of the new nodes in the DataStore
+		 */
+		static void addDataStoreNodes(DataStore ds, std::span<const std::string_view> names, std::span<const value_type> vals);
+
 	private:
 		MArgument& arg;
 	};
@@ -164,6 +183,11 @@ namespace LLU {
 	template<>                                                                                                    \
 	void PrimitiveWrapper<MArgumentType::ArgType>::addDataStoreNode(DataStore ds, value_type val);                        \
 	template<>                                                                                                    \
+	void PrimitiveWrapper<MArgumentType::ArgType>::addDataStoreNodes(DataStore ds, std::span<const value_type> vals);     \
+	template<>                                                                                                    \
+	void PrimitiveWrapper<MArgumentType::ArgType>::addDataStoreNodes(DataStore ds, std::span<const std::string_view> names,\
+																	 std::span<const value_type> vals);                  \
+	template<>                                                                                                    \
 	auto PrimitiveWrapper<MArgumentType::ArgType>::getAddress() const->typename PrimitiveWrapper::value_type*;                    \
 	template<>                                                                                                    \
 	void PrimitiveWrapper<MArgumentType::ArgType>::set(typename PrimitiveWrapper::value_type newValue);
@@ -178,6 +202,7 @@ namespace LLU {
 	LLU_ARGUMENT_DEFINE_SPECIALIZATIONS_OF_MEMBER_FUNCTIONS(NumericArray)
 	LLU_ARGUMENT_DEFINE_SPECIALIZATIONS_OF_MEMBER_FUNCTIONS(Image)
 	LLU_ARGUMENT_DEFINE_SPECIALIZATIONS_OF_MEMBER_FUNCTIONS(UTF8String)
+	LLU_ARGUMENT_DEFINE_SPECIALIZATIONS_OF_MEMBER_FUNCTIONS(TabularColumn)
 
 	template<>
 	auto PrimitiveWrapper<MArgumentType::MArgument>::get() -> typename PrimitiveWrapper::value_type&;
@@ -188,6 +213,11 @@ namespace LLU {
 	template<>
 	void PrimitiveWrapper<MArgumentType::MArgument>::addDataStoreNode(DataStore ds, value_type val) = delete;
 	template<>
+	void PrimitiveWrapper<MArgumentType::MArgument>::addDataStoreNodes(DataStore ds, std::span<const value_type> vals) = delete;
+	template<>
+	void PrimitiveWrapper<MArgumentType::MArgument>::addDataStoreNodes(DataStore ds, std::span<const std::string_view> names,
+																	   std::span<const value_type> vals) = delete;
+	template<>
 	auto PrimitiveWrapper<MArgumentType::MArgument>::getAddress() const -> typename PrimitiveWrapper::value_type*;
 	template<>
 	void PrimitiveWrapper<MArgumentType::MArgument>::set(typename PrimitiveWrapper::value_type newValue);
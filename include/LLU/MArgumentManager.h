@@ -9,11 +9,15 @@
 #ifndef LLU_MARGUMENTMANAGER_H
 #define LLU_MARGUMENTMANAGER_H
 
+#include <array>
 #include <complex>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -72,6 +76,18 @@ namespace LLU {
 		 **/
 		MArgumentManager(WolframLibraryData ld, mint Argc, MArgument* Args, MArgument& Res);
 
+		/// MArgumentManager owns string arguments it has read, so it cannot be copied
+		MArgumentManager(const MArgumentManager&) = delete;
+
+		/// Move constructor transfers the ownership of string arguments
+		MArgumentManager(MArgumentManager&& other) noexcept;
+
+		MArgumentManager& operator=(const MArgumentManager&) = delete;
+		MArgumentManager& operator=(MArgumentManager&&) = delete;
+
+		/// Destructor disowns all string arguments that were read
+		~MArgumentManager();
+
 		/************************************ MArgument "getters" ************************************/
 
 		/**
@@ -126,6 +142,23 @@ namespace LLU {
 		 **/
 		std::string getString(size_type index) const;
 
+		/**
+		 *   @brief         Get value of MArgument of type \b "UTF8String" at position \c index without copying it
+		 *   @param[in]     index - position of desired MArgument in \c Args
+		 *   @returns       \b std::string_view over the string received from LibraryLink, valid as long as this MArgumentManager
+		 *   @throws        LLErrorCode::MArgumentIndexError - if \c index is out-of-bounds
+		 **/
+		std::string_view getStringView(size_type index) const;
+
+		/**
+		 *   @brief         Get raw bytes of MArgument of type \b "UTF8String" at position \c index without copying them
+		 *   @param[in]     index - position of desired MArgument in \c Args
+		 *   @returns       bytes of the UTF-8 encoded string received from LibraryLink, without the terminating null character,
+		 *                  valid as long as this MArgumentManager
+		 *   @throws        LLErrorCode::MArgumentIndexError - if \c index is out-of-bounds
+		 **/
+		std::span<const std::byte> getBytes(size_type index) const;
+
 		/**
 		 *   @brief         Get MArgument of type MNumericArray at position \p index and wrap it into NumericArray
 		 *   @tparam		T - type of data stored in NumericArray
@@ -418,9 +451,20 @@ namespace LLU {
 		///  @overload
 		void setString(const char* str);
 
-		///  @overload
+		/**
+		 *   @brief         Set \c str as output MArgument without copying it
+		 *   @param[in]     str - string to be returned to LibraryLink, MArgumentManager takes over its memory
+		 **/
 		void setString(std::string&& str);
 
+		/**
+		 *   @brief         Set \c str as output MArgument
+		 *   @details       The string is copied into a per-thread buffer, whose memory is reused between calls and grows geometrically,
+		 *                  so returning strings of similar size repeatedly does not allocate.
+		 *   @param[in]     str - string to be returned to LibraryLink
+		 **/
+		void setString(std::string_view str);
+
 		/**
 		 *   @brief         Set MNumericArray wrapped by \c na as output MArgument
 		 *   @tparam		T - NumericArray data type
@@ -535,11 +579,16 @@ namespace LLU {
 			setString(str);
 		}
 
-		/// @copydoc setString
+		/// @copydoc setString(std::string&&)
 		void set(std::string&& str) {
 			setString(std::move(str));
 		}
 
+		/// @copydoc setString(std::string_view)
+		void set(std::string_view str) {
+			setString(str);
+		}
+
 		/// @copydoc setNumericArray
 		template<typename T>
 		void set(const NumericArray<T>& na) {
@@ -670,6 +719,20 @@ namespace LLU {
 		template<Passing Mode = Passing::Automatic, class Operator>
 		decltype(auto) operateOnNumericArray(size_type index, Operator&& op);
 
+		/**
+		 *   @brief         Perform operation on NumericArray created from MNumericArray argument at position \p index in \c Args,
+		 *                  instantiating the operation only for given element types
+		 *   @tparam		Types - TypeList of NumericArray element types to support, e.g. IntegerTypes
+		 *   @tparam		Mode - passing mode of the NumericArray that will be processed
+		 *   @tparam		Operator - any callable class
+		 *   @param[in]     index - position of MNumericArray in \c Args
+		 *   @param[in]     op - callable object (possibly lambda) that takes only one argument - a NumericArray of one of the \c Types
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @throws        ErrorName::MArgumentNumericArrayError - if element type of the MNumericArray argument is not one of the \c Types
+		 **/
+		template<class Types, Passing Mode = Passing::Automatic, class Operator>
+		decltype(auto) operateOnNumericArray(size_type index, Operator&& op);
+
 		/**
 		 *   @brief         Get type of MTensor at position \c index in \c Args
 		 *   @param[in]     index - position of desired MArgument in \c Args
@@ -704,6 +767,20 @@ namespace LLU {
 		template<Passing Mode = Passing::Automatic, class Operator>
 		decltype(auto) operateOnTensor(size_type index, Operator&& op);
 
+		/**
+		 *   @brief         Perform operation on Tensor created from MTensor argument at position \p index in \c Args,
+		 *                  instantiating the operation only for given element types
+		 *   @tparam		Types - TypeList of Tensor element types to support, e.g. TypeList<double>
+		 *   @tparam		Mode - passing mode of the Tensor that will be processed
+		 *   @tparam		Operator - any callable class
+		 *   @param[in]     index - position of MTensor in \c Args
+		 *   @param[in]     op - callable object (possibly lambda) that takes only one argument - a Tensor of one of the \c Types
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @throws        ErrorName::MArgumentTensorError - if element type of the MTensor argument is not one of the \c Types
+		 **/
+		template<class Types, Passing Mode = Passing::Automatic, class Operator>
+		decltype(auto) operateOnTensor(size_type index, Operator&& op);
+
 		/**
 		 *   @brief         Get type of MImage at position \c index in \c Args
 		 *   @param[in]     index - position of desired MArgument in \c Args
@@ -738,6 +815,20 @@ namespace LLU {
 		template<Passing Mode = Passing::Automatic, class Operator>
 		decltype(auto) operateOnImage(size_type index, Operator&& op);
 
+		/**
+		 *   @brief         Perform operation on Image created from MImage argument at position \p index in \c Args,
+		 *                  instantiating the operation only for given element types
+		 *   @tparam		Types - TypeList of Image element types to support, e.g. TypeList<float, double>
+		 *   @tparam		Mode - passing mode of the Image that will be processed
+		 *   @tparam		Operator - any callable class
+		 *   @param[in]     index - position of MImage in \c Args
+		 *   @param[in]     op - callable object (possibly lambda) that takes only one argument - an Image of one of the \c Types
+		 *   @throws        ErrorName::MArgumentIndexError - if \c index is out-of-bounds
+		 *   @throws        ErrorName::MArgumentImageError - if element type of the MImage argument is not one of the \c Types
+		 **/
+		template<class Types, Passing Mode = Passing::Automatic, class Operator>
+		decltype(auto) operateOnImage(size_type index, Operator&& op);
+
 		/**
 		 * @brief       Perform operation on SparseArray created from MSparseArray argument at position \p index in \c Args
 		 * @tparam      Mode - passing mode of the Image that will be processed
@@ -775,6 +866,9 @@ namespace LLU {
 		 */
 		template<typename T>
 		struct Getter {
+			/// Marks the default Getter, which constructs user-defined types directly from the corresponding basic arguments
+			using DefaultGetterTag = void;
+
 			/**
 			 * A function that tells LLU how to interpret an object of a user-defined type as an argument of a library function
 			 * This function is used internally by MArgumentManager::get.
@@ -809,21 +903,10 @@ namespace LLU {
 		template<typename... ArgTypes>
 		struct MArgPackGetter {
 			template<size_type... Indices>
-			static std::tuple<ArgTypes...>
+			static std::tuple<RequestedType<ArgTypes>...>
 			getImpl(const MArgumentManager& mngr, std::array<size_type, sizeof...(ArgTypes)> inds, std::index_sequence<Indices...> /*seq*/) {
-				if (sizeof...(ArgTypes) > static_cast<size_type>(mngr.argc)) {
-					ErrorManager::throwException(ErrorName::MArgumentIndexError);
-				}
-				return {mngr.get<ArgTypes>(inds[Indices])...};
-			}
-		};
-
-		template<typename, typename>
-		struct DefaultCustomGetter;
-		template<typename T, typename... Args>
-		struct DefaultCustomGetter<T, std::tuple<Args...>> {
-			static T get(const MArgumentManager& mngr, size_type firstIndex) {
-				return std::make_from_tuple<T>(mngr.getTuple<Args...>(firstIndex));
+				mngr.checkArgumentIndices(inds, {getArgSlotCount<std::remove_cv_t<ArgTypes>>()...});
+				return {mngr.getUnchecked<ArgTypes>(inds[Indices])...};
 			}
 		};
 
@@ -861,12 +944,85 @@ namespace LLU {
 				return offsets;
 			}
 		}
+
+		/// Arguments of these types are read directly from MArgument, which cannot fail once the index is known to be valid
+		template<typename T>
+		static constexpr bool isScalarArgument = std::is_integral_v<T> || std::is_same_v<T, double> || std::is_same_v<T, std::complex<double>>;
+
+		template<typename T>
+		static constexpr bool hasDefaultGetter = requires { typename Getter<T>::DefaultGetterTag; };
+
+		template<typename, typename>
+		struct DefaultCustomGetter;
+		template<typename T, typename... Args>
+		struct DefaultCustomGetter<T, std::tuple<Args...>> {
+			static constexpr std::array<size_type, sizeof...(Args)> slotCounts {getArgSlotCount<Args>()...};
+
+			static T get(const MArgumentManager& mngr, size_type firstIndex) {
+				const auto indices = getOffsets(firstIndex, slotCounts);
+				mngr.checkArgumentIndices(indices, slotCounts);
+				return construct(mngr, indices, std::index_sequence_for<Args...> {});
+			}
+
+			/// Construct T in place from the arguments starting at \p firstIndex, which the caller already checked to be in range
+			static T getUnchecked(const MArgumentManager& mngr, size_type firstIndex) noexcept(isNothrowConstructible) {
+				return construct(mngr, getOffsets(firstIndex, slotCounts), std::index_sequence_for<Args...> {});
+			}
+
+		private:
+			static constexpr bool isNothrowConstructible = (isScalarArgument<Args> && ...) && std::is_nothrow_constructible_v<T, RequestedType<Args>...>;
+
+			template<size_type... Is>
+			static T construct(const MArgumentManager& mngr, const std::array<size_type, sizeof...(Args)>& indices,
+							   std::index_sequence<Is...> /*seq*/) noexcept(isNothrowConstructible) {
+				return T(mngr.getUnchecked<Args>(indices[Is])...);
+			}
+		};
+
 		/********************************* End of user-defined types registration ************************************/
 
 	private:
 
-		// Efficient and memory-safe type for storing string arguments from LibraryLink
-		using LLStringPtr = std::unique_ptr<char[], decltype(st_WolframLibraryData::UTF8String_disown)>;
+		/**
+		 * @brief   Get argument at given index, which the caller already checked to be in range
+		 * @details Basic scalar types and user-defined types with the default Getter are read directly, other types go through get<T>.
+		 */
+		template<typename T>
+		RequestedType<T> getUnchecked(size_type index) const noexcept(isScalarArgument<std::remove_cv_t<T>>) {
+			using U = std::remove_cv_t<T>;
+			// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic): the index was checked against argc by the caller
+			if constexpr (std::is_same_v<U, bool>) {
+				return MArgument_getBoolean(args[index]) != False;
+			} else if constexpr (std::is_integral_v<U>) {
+				return static_cast<U>(MArgument_getInteger(args[index]));
+			} else if constexpr (std::is_same_v<U, double>) {
+				return static_cast<double>(MArgument_getReal(args[index]));
+			} else if constexpr (std::is_same_v<U, std::complex<double>>) {
+				const auto* mc = MArgument_getComplexAddress(args[index]);
+				return {mc->ri[0], mc->ri[1]};
+			} else if constexpr (isCustomMArgumentType<U> && hasDefaultGetter<U>) {
+				return DefaultCustomGetter<U, typename CustomType<U>::CorrespondingTypes>::getUnchecked(*this, index);
+			} else {
+				return get<T>(index);
+			}
+			// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+		}
+
+		/**
+		 * @brief   Check that each group of \p slotCounts[i] arguments starting at \p indices[i] lies within the arguments passed to the library function
+		 * @throws  ErrorName::MArgumentIndexError - if any argument is out-of-bounds
+		 */
+		template<size_t N>
+		void checkArgumentIndices(const std::array<size_type, N>& indices, const std::array<size_type, N>& slotCounts) const {
+			const auto argCount = static_cast<size_type>(argc);
+			for (size_t i = 0; i < N; ++i) {
+				if (indices[i] >= argCount || slotCounts[i] > argCount - indices[i]) {
+					ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentIndexError,
+															  "Index " + std::to_string(indices[i] + slotCounts[i] - 1) +
+																  " out-of-bound when accessing LibraryLink argument");
+				}
+			}
+		}
 
 		/**
 		 *   @brief			Get MArgument at position \c index
@@ -875,20 +1031,63 @@ namespace LLU {
 		 **/
 		MArgument getArgs(size_type index) const;
 
-		/**
-		 * @brief Helper function to initialize string arguments vector
-		 */
-		void initStringArgs();
-
 		/**
 		 * @brief Take ownership of UTF8String argument passed via LibraryLink.
 		 *
-		 * This wraps the raw char* into unique_ptr and all further accesses to the argument happen via the unique_ptr.
-		 * The string argument is automatically deallocated when MArgumentManager instance is destroyed.
+		 * The pointer to the string is stored, so that all further accesses to the argument use it, and the string is disowned when MArgumentManager
+		 * instance is destroyed.
 		 *
 		 * @param index - position of desired MArgument in \c Args
+		 * @return the string argument
+		 */
+		char* acquireUTF8String(size_type index) const;
+
+		/// Get the slot for the string argument at given index, which must be a valid argument index
+		char*& stringArg(size_type index) const;
+
+		/// Get the element type of Container<T> as reported by LibraryLink, e.g. NumericArrayType<T> for NumericArray
+		template<template<typename> class Container, typename T>
+		static constexpr auto elementType() noexcept {
+			if constexpr (std::is_same_v<Container<T>, NumericArray<T>>) {
+				return NumericArrayType<T>;
+			} else if constexpr (std::is_same_v<Container<T>, Tensor<T>>) {
+				return TensorType<T>;
+			} else {
+				static_assert(std::is_same_v<Container<T>, Image<T>>, "Typed dispatch is supported only for NumericArray, Tensor and Image.");
+				return ImageType<T>;
+			}
+		}
+
+		/**
+		 * @brief   Wrap a generic container into Container<T>, where T is the type from the list whose element type is \p type, and call \p op on it
+		 * @note    The caller must check that \p type is the element type of one of the types on the list, otherwise the last type is used.
 		 */
-		void acquireUTF8String(size_type index) const;
+		template<template<typename> class Container, typename T, typename... Ts, class Generic, typename ElementType, class Operator>
+		static decltype(auto) invokeTyped(Generic&& generic, ElementType type, Operator& op) {
+			if constexpr (sizeof...(Ts) == 0) {
+				Unused(type);
+				return std::invoke(op, Container<T> {std::forward<Generic>(generic), TypeCheckedTag {}});
+			} else {
+				if (type == elementType<Container, T>()) {
+					return std::invoke(op, Container<T> {std::forward<Generic>(generic), TypeCheckedTag {}});
+				}
+				return invokeTyped<Container, Ts...>(std::forward<Generic>(generic), type, op);
+			}
+		}
+
+		/// Dispatch a generic container with elements of given type to an operation on Container<T>, for T in the type list
+		template<template<typename> class Container, class Generic, typename ElementType, class Operator, typename... Ts>
+		static decltype(auto) operateOnTyped(Generic&& generic, ElementType type, Operator& op, TypeList<Ts...> /* types */) {
+			static_assert(sizeof...(Ts) > 0, "The list of element types must not be empty.");
+			static_assert(((elementType<Container, Ts>() != elementType<Container, void>()) && ...), "Unsupported element type in the type list.");
+			return invokeTyped<Container, Ts...>(std::forward<Generic>(generic), type, op);
+		}
+
+		/// Check if \p type is the element type of Container<T> for any T in the type list
+		template<template<typename> class Container, typename ElementType, typename... Ts>
+		static constexpr bool isElementTypeOf(ElementType type, TypeList<Ts...> /* types */) noexcept {
+			return ((type == elementType<Container, Ts>()) || ...);
+		}
 
 		/**
 		 * @brief   Convert passing mode to ownership info
@@ -905,10 +1104,11 @@ namespace LLU {
 			return Ownership::LibraryLink;
 		}
 
-		/// Here we store a string that was most recently returned to LibraryLink
+		/// Here we store a string that was most recently returned to LibraryLink from the current thread, LibraryLink copies it after the library
+		/// function returns, so library functions running in different threads do not overwrite each other's results
 		/// [LLDocs]: https://reference.wolfram.com/language/LibraryLink/tutorial/InteractionWithMathematica.html#262826223 "LibraryLink docs"
 		/// @see [LibraryLink docs][LLDocs]
-		static std::string stringResultBuffer;
+		static thread_local std::string stringResultBuffer;
 
 		/// Max \b mint value
 		static constexpr mint MINT_MAX = (std::numeric_limits<mint>::max)();
@@ -925,10 +1125,16 @@ namespace LLU {
 		/// Output argument for LibraryLink
 		MArgument& res;
 
-		/// Structure to manage string arguments after taking their ownership from LibraryLink
+		/// Number of leading arguments whose string ownership is tracked without allocating memory
+		static constexpr size_type InlineStringArgCount = 8;
+
+		/// String arguments taken from LibraryLink, they must be disowned by the library
 		/// [LLDocs]: https://reference.wolfram.com/language/LibraryLink/tutorial/InteractionWithMathematica.html#262826223 "LibraryLink docs"
 		/// @see [LibraryLink docs][LLDocs]
-		mutable std::vector<LLStringPtr> stringArgs;
+		mutable std::array<char*, InlineStringArgCount> stringArgs {};
+
+		/// String arguments at positions InlineStringArgCount and higher, allocated on the first access to such argument
+		mutable std::unique_ptr<char*[]> moreStringArgs;
 	};
 
 /// @cond
@@ -947,6 +1153,7 @@ namespace LLU {
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION(double, getReal)
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION(std::string, getString)
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION(const char*, getCString)
+	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION(std::string_view, getStringView)
 	LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION(std::complex<double>, getComplex)
 
 #undef LLU_MARGUMENTMANAGER_GENERATE_GET_SPECIALIZATION
@@ -1012,44 +1219,23 @@ namespace LLU {
 	template<Passing Mode, class Operator, class... Args>
 	decltype(auto) MArgumentManager::operateOnNumericArray(size_type index, Args&&... opArgs) {
 		Operator op;
-		switch (getNumericArrayType(index)) {
-			case MNumericArray_Type_Bit8: return std::invoke(op, this->getNumericArray<int8_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_UBit8: return std::invoke(op, this->getNumericArray<uint8_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Bit16: return std::invoke(op, this->getNumericArray<int16_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_UBit16: return std::invoke(op, this->getNumericArray<uint16_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Bit32: return std::invoke(op, this->getNumericArray<int32_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_UBit32: return std::invoke(op, this->getNumericArray<uint32_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Bit64: return std::invoke(op, this->getNumericArray<int64_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_UBit64: return std::invoke(op, this->getNumericArray<uint64_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Real32: return std::invoke(op, this->getNumericArray<float, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Real64: return std::invoke(op, this->getNumericArray<double, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Complex_Real32: return std::invoke(op, this->getNumericArray<std::complex<float>, Mode>(index), std::forward<Args>(opArgs)...);
-			case MNumericArray_Type_Complex_Real64: return std::invoke(op, this->getNumericArray<std::complex<double>, Mode>(index), std::forward<Args>(opArgs)...);
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentNumericArrayError,
-														  "Incorrect type of NumericArray argument. Argument index: " + std::to_string(index));
-		}
+		return operateOnNumericArray<NumericArrayTypes, Mode>(
+			index, [&op, &opArgs...](auto&& na) -> decltype(auto) { return std::invoke(op, std::forward<decltype(na)>(na), std::forward<Args>(opArgs)...); });
 	}
 
 	template<Passing Mode, class Operator>
 	decltype(auto) MArgumentManager::operateOnNumericArray(size_type index, Operator&& op) {
-		switch (getNumericArrayType(index)) {
-			case MNumericArray_Type_Bit8: return std::invoke(op, this->getNumericArray<int8_t, Mode>(index));
-			case MNumericArray_Type_UBit8: return std::invoke(op, this->getNumericArray<uint8_t, Mode>(index));
-			case MNumericArray_Type_Bit16: return std::invoke(op, this->getNumericArray<int16_t, Mode>(index));
-			case MNumericArray_Type_UBit16: return std::invoke(op, this->getNumericArray<uint16_t, Mode>(index));
-			case MNumericArray_Type_Bit32: return std::invoke(op, this->getNumericArray<int32_t, Mode>(index));
-			case MNumericArray_Type_UBit32: return std::invoke(op, this->getNumericArray<uint32_t, Mode>(index));
-			case MNumericArray_Type_Bit64: return std::invoke(op, this->getNumericArray<int64_t, Mode>(index));
-			case MNumericArray_Type_UBit64: return std::invoke(op, this->getNumericArray<uint64_t, Mode>(index));
-			case MNumericArray_Type_Real32: return std::invoke(op, this->getNumericArray<float, Mode>(index));
-			case MNumericArray_Type_Real64: return std::invoke(op, this->getNumericArray<double, Mode>(index));
-			case MNumericArray_Type_Complex_Real32: return std::invoke(op, this->getNumericArray<std::complex<float>, Mode>(index));
-			case MNumericArray_Type_Complex_Real64: return std::invoke(op, this->getNumericArray<std::complex<double>, Mode>(index));
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentNumericArrayError,
-														  "Incorrect type of NumericArray argument. Argument index: " + std::to_string(index));
+		return operateOnNumericArray<NumericArrayTypes, Mode>(index, std::forward<Operator>(op));
+	}
+
+	template<class Types, Passing Mode, class Operator>
+	decltype(auto) MArgumentManager::operateOnNumericArray(size_type index, Operator&& op) {
+		const auto type = getNumericArrayType(index);
+		if (!isElementTypeOf<NumericArray>(type, Types {})) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentNumericArrayError,
+													  "Incorrect type of NumericArray argument. Argument index: " + std::to_string(index));
 		}
+		return operateOnTyped<NumericArray>(getGenericNumericArray<Mode>(index), type, op, Types {});
 	}
 
 	template<typename T, Passing Mode>
@@ -1065,26 +1251,23 @@ namespace LLU {
 	template<Passing Mode, class Operator, class... Args>
 	decltype(auto) MArgumentManager::operateOnTensor(size_type index, Args&&... opArgs) {
 		Operator op;
-		switch (getTensorType(index)) {
-			case MType_Integer: return std::invoke(op, this->getTensor<mint, Mode>(index), std::forward<Args>(opArgs)...);
-			case MType_Real: return std::invoke(op, this->getTensor<double, Mode>(index), std::forward<Args>(opArgs)...);
-			case MType_Complex: return std::invoke(op, this->getTensor<std::complex<double>, Mode>(index), std::forward<Args>(opArgs)...);
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentTensorError,
-														  "Incorrect type of Tensor argument. Argument index: " + std::to_string(index));
-		}
+		return operateOnTensor<TensorTypes, Mode>(
+			index, [&op, &opArgs...](auto&& t) -> decltype(auto) { return std::invoke(op, std::forward<decltype(t)>(t), std::forward<Args>(opArgs)...); });
 	}
 
 	template<Passing Mode, class Operator>
 	decltype(auto) MArgumentManager::operateOnTensor(size_type index, Operator&& op) {
-		switch (getTensorType(index)) {
-			case MType_Integer: return std::invoke(op, this->getTensor<mint, Mode>(index));
-			case MType_Real: return std::invoke(op, this->getTensor<double, Mode>(index));
-			case MType_Complex: return std::invoke(op, this->getTensor<std::complex<double>, Mode>(index));
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentTensorError,
-														  "Incorrect type of Tensor argument. Argument index: " + std::to_string(index));
+		return operateOnTensor<TensorTypes, Mode>(index, std::forward<Operator>(op));
+	}
+
+	template<class Types, Passing Mode, class Operator>
+	decltype(auto) MArgumentManager::operateOnTensor(size_type index, Operator&& op) {
+		const auto type = getTensorType(index);
+		if (!isElementTypeOf<Tensor>(type, Types {})) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentTensorError,
+													  "Incorrect type of Tensor argument. Argument index: " + std::to_string(index));
 		}
+		return operateOnTyped<Tensor>(getGenericTensor<Mode>(index), type, op, Types {});
 	}
 
 	template<typename T, Passing Mode>
@@ -1100,30 +1283,23 @@ namespace LLU {
 	template<Passing Mode, class Operator, class... Args>
 	decltype(auto) MArgumentManager::operateOnImage(size_type index, Args&&... opArgs) {
 		Operator op;
-		switch (getImageType(index)) {
-			case MImage_Type_Bit: return std::invoke(op, this->getImage<int8_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MImage_Type_Bit8: return std::invoke(op, this->getImage<uint8_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MImage_Type_Bit16: return std::invoke(op, this->getImage<uint16_t, Mode>(index), std::forward<Args>(opArgs)...);
-			case MImage_Type_Real32: return std::invoke(op, this->getImage<float, Mode>(index), std::forward<Args>(opArgs)...);
-			case MImage_Type_Real: return std::invoke(op, this->getImage<double, Mode>(index), std::forward<Args>(opArgs)...);
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentImageError,
-														  "Incorrect type of Image argument. Argument index: " + std::to_string(index));
-		}
+		return operateOnImage<ImageTypes, Mode>(
+			index, [&op, &opArgs...](auto&& im) -> decltype(auto) { return std::invoke(op, std::forward<decltype(im)>(im), std::forward<Args>(opArgs)...); });
 	}
 
 	template<Passing Mode, class Operator>
 	decltype(auto) MArgumentManager::operateOnImage(size_type index, Operator&& op) {
-		switch (getImageType(index)) {
-			case MImage_Type_Bit: return std::invoke(op, this->getImage<int8_t, Mode>(index));
-			case MImage_Type_Bit8: return std::invoke(op, this->getImage<uint8_t, Mode>(index));
-			case MImage_Type_Bit16: return std::invoke(op, this->getImage<uint16_t, Mode>(index));
-			case MImage_Type_Real32: return std::invoke(op, this->getImage<float, Mode>(index));
-			case MImage_Type_Real: return std::invoke(op, this->getImage<double, Mode>(index));
-			default:
-				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentImageError,
-														  "Incorrect type of Image argument. Argument index: " + std::to_string(index));
+		return operateOnImage<ImageTypes, Mode>(index, std::forward<Operator>(op));
+	}
+
+	template<class Types, Passing Mode, class Operator>
+	decltype(auto) MArgumentManager::operateOnImage(size_type index, Operator&& op) {
+		const auto type = getImageType(index);
+		if (!isElementTypeOf<Image>(type, Types {})) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentImageError,
+													  "Incorrect type of Image argument. Argument index: " + std::to_string(index));
 		}
+		return operateOnTyped<Image>(getGenericImage<Mode>(index), type, op, Types {});
 	}
 
 	template<typename T, Passing Mode>
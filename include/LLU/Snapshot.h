@@ -0,0 +1,262 @@
+/**
+ * @file	Snapshot.h
+ * @date	October 19, 2026
+ * @brief	Definition of a binary snapshot format for LibraryLink containers.
+ */
+#ifndef LLU_SNAPSHOT_H
+#define LLU_SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "LLU/Compression.h"
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/MappedArray.h"
+#include "LLU/FileUtilities.h"
+#include "LLU/TypedMArgument.h"
+
+/**
+ * @brief   Reading and writing snapshots - binary files with named values of any type that can be stored in a DataList.
+ * @details A snapshot starts with a fixed-size header and ends with an index, which describes every entry and points to its payload sections.
+ *          Payload sections hold the contents of containers (Tensor, NumericArray, Image, SparseArray, DataVector) in exactly the same layout as
+ *          in memory and each of them starts at a multiple of PayloadAlignment bytes, so arrays can be mapped into memory and used without copying.
+ *          SparseArrays are stored in the CSR form (row pointers, column indices and explicit values) and DataLists are stored recursively.
+ *
+ *          Payload sections can optionally be compressed with LZ4, in independent blocks of CompressionBlockSize bytes. A section is stored
+ *          uncompressed if compression does not make it smaller. Compressed sections are decompressed by Reader::read() and cannot be mapped.
+ *
+ *          Snapshots are written in the native byte order with the native size of mint, Reader rejects snapshots written on a platform
+ *          where either of those differs.
+ */
+namespace LLU::Snapshot {
+
+	/// Version of the snapshot format, Reader accepts snapshots of this version only
+	inline constexpr std::uint32_t FormatVersion = 1;
+
+	/// Alignment of payload sections in the file, in bytes
+	inline constexpr std::size_t PayloadAlignment = 64;
+
+	/// Number of bytes of a payload section compressed independently of the rest of the section
+	inline constexpr std::size_t CompressionBlockSize = std::size_t {1} << 20;
+
+	/**
+	 * @class   Writer
+	 * @brief   Writes named values into a new snapshot file.
+	 * @details Payloads are written directly from the memory of the containers as soon as the values are added, only the index is kept in memory
+	 *          until finish() is called. A snapshot is not valid until finish() is called, so an interrupted Writer never leaves behind a file that
+	 *          could be mistaken for a complete snapshot.
+	 */
+	class Writer {
+	public:
+		/**
+		 * @brief   Create a new snapshot file, replacing the file if it already exists.
+		 * @param   fileName - path to the file
+		 * @param   codec - compression applied to payload sections, strings are never compressed so that read() can return views of the file
+		 * @param   level - compression level from 1 (fastest) to 9 (best compression)
+		 * @throws  ErrorName::OpenFileFailed - if the file could not be opened for writing
+		 */
+		explicit Writer(const std::string& fileName, NA::Codec codec = NA::Codec::None, int level = 1);
+
+		/**
+		 * @brief   Add a named value to the snapshot.
+		 * @param   name - name of the entry, names do not have to be unique
+		 * @param   value - value of any type that can be stored in a DataList, containers are not modified and their ownership does not change
+		 * @throws  ErrorName::DLInvalidNodeType - if \p value is empty
+		 * @throws  ErrorName::FileWriteFailed - if writing to the file failed
+		 */
+		void add(std::string_view name, const Argument::TypedArgument& value);
+
+		/// @copydoc add(std::string_view, const Argument::TypedArgument&)
+		void add(std::string_view name, const GenericTensor& value);
+
+		/// @copydoc add(std::string_view, const Argument::TypedArgument&)
+		void add(std::string_view name, const GenericNumericArray& value);
+
+		/// @copydoc add(std::string_view, const Argument::TypedArgument&)
+		void add(std::string_view name, const GenericImage& value);
+
+		/// @copydoc add(std::string_view, const Argument::TypedArgument&)
+		void add(std::string_view name, const GenericSparseArray& value);
+
+		/// @copydoc add(std::string_view, const Argument::TypedArgument&)
+		void add(std::string_view name, const DataVector& value);
+
+		/// @copydoc add(std::string_view, const Argument::TypedArgument&)
+		void add(std::string_view name, const GenericDataList& value);
+
+		/**
+		 * @brief   Add every node of a DataList as a separate entry of the snapshot.
+		 * @param   list - a DataList, node names become entry names
+		 */
+		void addAll(const GenericDataList& list);
+
+		/**
+		 * @brief   Write the index and close the file. No entries can be added afterwards.
+		 * @throws  ErrorName::FileWriteFailed - if writing to the file failed
+		 */
+		void finish();
+
+	private:
+		/// Append the description of a named node to the index and write its payload
+		template<typename T>
+		void writeNode(std::string_view name, MArgumentType kind, const T& value);
+
+		void writeValue(const Argument::TypedArgument& value);
+		void writeValue(const GenericTensor& value);
+		void writeValue(const GenericNumericArray& value);
+		void writeValue(const GenericImage& value);
+		void writeValue(const GenericSparseArray& value);
+		void writeValue(const DataVector& value);
+		void writeValue(const GenericDataList& value);
+
+		/// Write a payload section at the next aligned position in the file, compressed with the codec of the Writer, and append its location to the index
+		void writeSection(std::span<const std::byte> payload);
+
+		/// Write a payload section compressed with given codec
+		void writeSection(std::span<const std::byte> payload, NA::Codec sectionCodec);
+
+		/// Append raw bytes to the index
+		void putBytes(const void* bytes, std::size_t count);
+
+		/// Append a fixed-size value to the index
+		template<typename T>
+		void put(T value) {
+			putBytes(&value, sizeof(T));
+		}
+
+		/// Append a string, with its length and a terminating null character, to the index
+		void putString(std::string_view s);
+
+		/// Append dimensions, preceded by the rank, to the index
+		void putDimensions(mint rank, const mint* dims);
+
+		/// Write bytes to the file
+		void writeBytes(const void* bytes, std::size_t count);
+
+		/// Path to the file, for error messages
+		std::string fileName;
+
+		/// Output file, empty after finish()
+		FilePtr file;
+
+		/// Compression applied to payload sections
+		NA::Codec codec;
+
+		/// Compression level
+		int level;
+
+		/// Number of bytes written to the file so far
+		std::uint64_t position = 0;
+
+		/// Index of all entries, written at the end of the file
+		std::string index;
+
+		/// Number of top-level entries
+		std::uint64_t entryCount = 0;
+	};
+
+	/**
+	 * @class   Reader
+	 * @brief   Reads values from a snapshot file.
+	 * @details The whole file is mapped into memory when the Reader is created and only the index is parsed. Values are copied into new
+	 *          LibraryLink containers by read(), numeric arrays can also be mapped without copying with map(). Strings returned by read() point into
+	 *          the mapped file, so they stay valid only as long as the Reader.
+	 */
+	class Reader {
+	public:
+		/**
+		 * @brief   Open a snapshot file.
+		 * @param   fileName - path to the file
+		 * @throws  ErrorName::OpenFileFailed, ErrorName::MapFileFailed - if the file could not be mapped into memory
+		 * @throws  ErrorName::InvalidSnapshot - if the file is not a complete snapshot written on a compatible platform
+		 */
+		explicit Reader(const std::string& fileName);
+
+		/// Get the number of top-level entries
+		[[nodiscard]] std::size_t size() const noexcept {
+			return entries.size();
+		}
+
+		/// Get the names of all top-level entries, in the order in which they were added
+		[[nodiscard]] std::vector<std::string_view> names() const;
+
+		/// Check if there is a top-level entry with given name
+		[[nodiscard]] bool contains(std::string_view name) const noexcept;
+
+		/**
+		 * @brief   Get the type of the first top-level entry with given name.
+		 * @throws  ErrorName::SnapshotEntryNotFound - if there is no such entry
+		 */
+		[[nodiscard]] MArgumentType type(std::string_view name) const;
+
+		/**
+		 * @brief   Read the first top-level entry with given name.
+		 * @param   name - name of the entry
+		 * @return  the value of the entry, containers are new copies owned by the library
+		 * @throws  ErrorName::SnapshotEntryNotFound - if there is no such entry
+		 * @throws  ErrorName::InvalidSnapshot - if the description of the entry is corrupted
+		 */
+		[[nodiscard]] Argument::TypedArgument read(std::string_view name) const;
+
+		/**
+		 * @brief   Read all top-level entries into a DataList.
+		 * @throws  ErrorName::InvalidSnapshot - if the description of any entry is corrupted
+		 */
+		[[nodiscard]] GenericDataList readAll() const;
+
+		/**
+		 * @brief   Map the data of a Tensor or NumericArray entry into memory without copying.
+		 * @details The pages of the array are shared with the Reader and with other processes that read the same file. Images can be mapped too,
+		 *          in which case the MappedArray is one-dimensional and holds all the pixel data in the order of Image::rawData().
+		 * @tparam  T - type of array elements, must match the type of the stored array
+		 * @param   name - name of the entry
+		 * @throws  ErrorName::SnapshotEntryNotFound - if there is no such entry
+		 * @throws  ErrorName::SnapshotEntryType - if the entry is not an array of elements of type T
+		 * @throws  ErrorName::SnapshotEntryCompressed - if the data of the entry is compressed
+		 */
+		template<typename T>
+		[[nodiscard]] MappedArray<T> map(std::string_view name) const {
+			auto [dims, offset] = arrayLayout(name, NumericArrayType<T>);
+			return MappedArray<T> {fileName, std::move(dims), offset};
+		}
+
+	private:
+		/// Top-level entry of the snapshot
+		struct Entry {
+			std::string_view name;
+			MArgumentType kind;
+			std::span<const std::byte> description;
+		};
+
+		/// Find the first top-level entry with given name or throw
+		[[nodiscard]] const Entry& find(std::string_view name) const;
+
+		/// Get the dimensions and the position in the file of an array entry, checking its element type
+		[[nodiscard]] std::pair<MArrayDimensions, std::size_t> arrayLayout(std::string_view name, numericarray_data_t elementType) const;
+
+		/// Get the part of the file before the index, where all payload sections are
+		[[nodiscard]] std::span<const std::byte> payloads() const noexcept {
+			return {file.data(), payloadSize};
+		}
+
+		/// Path to the file, for error messages and for map()
+		std::string fileName;
+
+		/// The whole file mapped into memory
+		MappedFile file;
+
+		/// Size of the part of the file before the index
+		std::size_t payloadSize = 0;
+
+		/// Top-level entries in the order in which they were written
+		std::vector<Entry> entries;
+	};
+
+}  // namespace LLU::Snapshot
+
+#endif	  // LLU_SNAPSHOT_H
@@ -0,0 +1,473 @@
+/**
+ * @file	TypedFunction.h
+ * @date	October 19, 2026
+ * @brief	Library functions with C++ parameter and return types known at compile time.
+ */
+#ifndef LLU_TYPEDFUNCTION_H
+#define LLU_TYPEDFUNCTION_H
+
+#include <algorithm>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "LLU/Async/ThreadPool.h"
+#include "LLU/Containers/DataList.h"
+#include "LLU/Containers/Generic/DataVector.hpp"
+#include "LLU/Containers/Image.h"
+#include "LLU/Containers/NumericArray.h"
+#include "LLU/Containers/SparseArray.h"
+#include "LLU/Containers/Tensor.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/LibraryData.h"
+#include "LLU/MArgumentManager.h"
+#include "LLU/TypedMArgument.h"
+
+namespace LLU {
+
+	/**
+	 * @brief   Describes how a value of type T is passed between LibraryLink and a typed library function (see LLU_TYPED_FUNCTION).
+	 * @details Every specialization provides:
+	 *          - \c typeSpec - the LibraryLink type of the argument, as it appears in LibraryFunctionLoad
+	 *          - \c Holder - type of the object created from a raw MArgument, which lives until the function returns
+	 *          - \c get(Holder&) - the value that is passed to the C++ function
+	 *
+	 *          Return values are passed to LibraryLink with MArgumentManager::set, so every type supported by MArgumentManager::set (including
+	 *          user-defined types with a Setter) can be returned as long as FunctionArgument defines its \c typeSpec.
+	 * @tparam  T - type of a parameter or the return type of a typed library function, without cv-qualifiers and references
+	 */
+	template<typename T>
+	struct FunctionArgument {
+		static_assert(dependent_false_v<T>, "Unsupported parameter or return type of a typed library function.");
+	};
+
+	/// @cond
+	namespace Detail {
+		/// Plain values that are read from MArgument by Argument::fromMArgument and converted to the parameter type
+		template<typename T, MArgumentType Type, typename Spec>
+		struct ScalarArgument {
+			using Holder = MArgument;
+			static constexpr std::string_view typeSpec = Spec::value;
+
+			static T get(Holder& m) {
+				return static_cast<T>(Argument::fromMArgument<Type>(m));
+			}
+		};
+
+		/// Containers are wrapped without taking ownership, strongly typed containers also check the type of data
+		template<typename T, MArgumentType Type, typename Spec>
+		struct ContainerArgument {
+			using Holder = MArgument;
+			static constexpr std::string_view typeSpec = Spec::value;
+
+			static T get(Holder& m) {
+				return T {Argument::fromMArgument<Type>(m)};
+			}
+		};
+
+		/// String arguments must be disowned by the library, which happens when the Holder is destroyed
+		class StringArgument {
+		public:
+			explicit StringArgument(MArgument m) : str {MArgument_getUTF8String(m)} {}
+			StringArgument(const StringArgument&) = delete;
+			StringArgument& operator=(const StringArgument&) = delete;
+			StringArgument(StringArgument&&) = delete;
+			StringArgument& operator=(StringArgument&&) = delete;
+			~StringArgument() {
+				LibraryData::API()->UTF8String_disown(str);
+			}
+
+			[[nodiscard]] char* get() const noexcept {
+				return str;
+			}
+
+		private:
+			char* str;
+		};
+
+		template<typename T>
+		struct StringArgumentGetter {
+			using Holder = StringArgument;
+			static constexpr std::string_view typeSpec = "String";
+
+			static T get(Holder& s) {
+				return T {s.get()};
+			}
+		};
+
+#define LLU_TYPED_FUNCTION_SPEC(Name, Spec)                  \
+	struct Name {                                            \
+		static constexpr std::string_view value = Spec;      \
+	};
+
+		LLU_TYPED_FUNCTION_SPEC(BooleanSpec, "\"Boolean\"")
+		LLU_TYPED_FUNCTION_SPEC(IntegerSpec, "Integer")
+		LLU_TYPED_FUNCTION_SPEC(RealSpec, "Real")
+		LLU_TYPED_FUNCTION_SPEC(ComplexSpec, "Complex")
+		LLU_TYPED_FUNCTION_SPEC(AnyTensorSpec, "{_, _}")
+		LLU_TYPED_FUNCTION_SPEC(IntegerTensorSpec, "{Integer, _}")
+		LLU_TYPED_FUNCTION_SPEC(RealTensorSpec, "{Real, _}")
+		LLU_TYPED_FUNCTION_SPEC(ComplexTensorSpec, "{Complex, _}")
+		LLU_TYPED_FUNCTION_SPEC(AnySparseArraySpec, "LibraryDataType[SparseArray]")
+		LLU_TYPED_FUNCTION_SPEC(IntegerSparseArraySpec, "LibraryDataType[SparseArray, Integer]")
+		LLU_TYPED_FUNCTION_SPEC(RealSparseArraySpec, "LibraryDataType[SparseArray, Real]")
+		LLU_TYPED_FUNCTION_SPEC(ComplexSparseArraySpec, "LibraryDataType[SparseArray, Complex]")
+		LLU_TYPED_FUNCTION_SPEC(NumericArraySpec, "NumericArray")
+		LLU_TYPED_FUNCTION_SPEC(ImageSpec, "LibraryDataType[Image | Image3D]")
+		LLU_TYPED_FUNCTION_SPEC(DataStoreSpec, "\"DataStore\"")
+		LLU_TYPED_FUNCTION_SPEC(TabularColumnSpec, "TabularColumn")
+		LLU_TYPED_FUNCTION_SPEC(VoidSpec, "\"Void\"")
+
+#undef LLU_TYPED_FUNCTION_SPEC
+
+		template<typename T>
+		struct TensorSpec;
+		template<>
+		struct TensorSpec<mint> : IntegerTensorSpec {};
+		template<>
+		struct TensorSpec<double> : RealTensorSpec {};
+		template<>
+		struct TensorSpec<std::complex<double>> : ComplexTensorSpec {};
+
+		template<typename T>
+		struct SparseArraySpec;
+		template<>
+		struct SparseArraySpec<mint> : IntegerSparseArraySpec {};
+		template<>
+		struct SparseArraySpec<double> : RealSparseArraySpec {};
+		template<>
+		struct SparseArraySpec<std::complex<double>> : ComplexSparseArraySpec {};
+
+		/// Integral types other than bool
+		template<typename T>
+		concept IntegerArgument = std::is_integral_v<T> && !std::is_same_v<T, bool>;
+
+		/// Scalar types which can be passed to and returned from the listable version of a typed function
+		template<typename T>
+		concept ListableScalar = std::is_arithmetic_v<T> || std::is_same_v<T, std::complex<double>>;
+
+		/// Type of Tensor elements which hold a list of values of type T in the listable version of a typed function, Booleans are stored as 0 and 1
+		template<ListableScalar T>
+		using ListableElement = std::conditional_t<std::is_integral_v<T>, mint, std::conditional_t<std::is_floating_point_v<T>, double, T>>;
+
+		/// Rank-1 container which holds a list of values of type T in the listable version of a typed function, a NumericArray or a Tensor
+		template<bool NumericArrays, ListableScalar T>
+		using ListableList = std::conditional_t<NumericArrays, NumericArray<ListableElement<T>>, Tensor<ListableElement<T>>>;
+
+		/// Read a list of arguments of type T, NumericArrays of other types are converted and the conversion fails unless all values are exact
+		template<bool NumericArrays, ListableScalar T>
+		ListableList<NumericArrays, T> listableArgument(MArgument m) {
+			if constexpr (NumericArrays) {
+				GenericNumericArray na {MArgument_getMNumericArray(m), Ownership::LibraryLink};
+				if (na.getRank() != 1) {
+					ErrorManager::throwException(ErrorName::MArgumentNumericArrayError);
+				}
+				if (na.type() == NumericArrayType<ListableElement<T>>) {
+					return ListableList<true, T> {std::move(na)};
+				}
+				return ListableList<true, T> {na, NA::ConversionMethod::Check};
+			} else {
+				return ListableList<false, T> {MArgument_getMTensor(m), Ownership::LibraryLink};
+			}
+		}
+
+		/// Column of arguments of a listable call, a list of length 1 is broadcast to all rows
+		template<typename T>
+		struct ListableColumn {
+			const ListableElement<T>* data;
+			std::size_t stride;
+
+			T operator[](std::size_t row) const noexcept {
+				if constexpr (std::is_same_v<T, bool>) {
+					return data[row * stride] != 0;
+				} else {
+					return static_cast<T>(data[row * stride]);
+				}
+			}
+		};
+
+		/**
+		 * @brief   Call task(begin, end) for consecutive ranges that cover [0, n), in parallel on up to \p threadCount threads
+		 * @details Small inputs are processed in the calling thread. Other ranges are submitted to a BasicPool and exceptions thrown there are rethrown
+		 *          in the calling thread after all ranges are done.
+		 * @param   n - number of items to process
+		 * @param   threadCount - maximal number of threads, 0 means the hardware concurrency
+		 * @param   task - callable object that processes a range of items, must not use the LibraryLink API if \p threadCount is not 1
+		 */
+		template<typename Task>
+		void forEachRange(std::size_t n, unsigned threadCount, const Task& task) {
+			constexpr std::size_t minRangeSize = 4096;
+			if (threadCount == 0) {
+				threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+			}
+			const auto rangeCount = std::min<std::size_t>(threadCount, n / minRangeSize);
+			if (rangeCount <= 1) {
+				task(std::size_t {0}, n);
+				return;
+			}
+			BasicPool pool {static_cast<unsigned>(rangeCount - 1)};
+			std::vector<std::future<void>> results;
+			results.reserve(rangeCount - 1);
+			for (std::size_t r = 1; r < rangeCount; ++r) {
+				results.push_back(pool.submit([&task, n, r, rangeCount] { task(n * r / rangeCount, n * (r + 1) / rangeCount); }));
+			}
+			std::exception_ptr error;
+			try {
+				task(std::size_t {0}, n / rangeCount);
+			} catch (...) {
+				error = std::current_exception();
+			}
+			// every future is waited for before the pool is destroyed, because the pool may drop tasks that have not started yet
+			for (auto& result : results) {
+				try {
+					result.get();
+				} catch (...) {
+					if (!error) {
+						error = std::current_exception();
+					}
+				}
+			}
+			if (error) {
+				std::rethrow_exception(error);
+			}
+		}
+	}  // namespace Detail
+
+	template<>
+	struct FunctionArgument<bool> : Detail::ScalarArgument<bool, MArgumentType::Boolean, Detail::BooleanSpec> {};
+
+	template<Detail::IntegerArgument T>
+	struct FunctionArgument<T> : Detail::ScalarArgument<T, MArgumentType::Integer, Detail::IntegerSpec> {};
+
+	template<std::floating_point T>
+	struct FunctionArgument<T> : Detail::ScalarArgument<T, MArgumentType::Real, Detail::RealSpec> {};
+
+	template<>
+	struct FunctionArgument<std::complex<double>> : Detail::ScalarArgument<std::complex<double>, MArgumentType::Complex, Detail::ComplexSpec> {};
+
+	template<>
+	struct FunctionArgument<std::string_view> : Detail::StringArgumentGetter<std::string_view> {};
+
+	template<>
+	struct FunctionArgument<std::string> : Detail::StringArgumentGetter<std::string> {};
+
+	template<>
+	struct FunctionArgument<const char*> : Detail::StringArgumentGetter<const char*> {};
+
+	template<>
+	struct FunctionArgument<GenericTensor> : Detail::ContainerArgument<GenericTensor, MArgumentType::Tensor, Detail::AnyTensorSpec> {};
+
+	template<typename T>
+	struct FunctionArgument<Tensor<T>> : Detail::ContainerArgument<Tensor<T>, MArgumentType::Tensor, Detail::TensorSpec<T>> {};
+
+	template<>
+	struct FunctionArgument<GenericSparseArray> : Detail::ContainerArgument<GenericSparseArray, MArgumentType::SparseArray, Detail::AnySparseArraySpec> {};
+
+	template<typename T>
+	struct FunctionArgument<SparseArray<T>> : Detail::ContainerArgument<SparseArray<T>, MArgumentType::SparseArray, Detail::SparseArraySpec<T>> {};
+
+	template<>
+	struct FunctionArgument<GenericNumericArray> : Detail::ContainerArgument<GenericNumericArray, MArgumentType::NumericArray, Detail::NumericArraySpec> {};
+
+	template<typename T>
+	struct FunctionArgument<NumericArray<T>> : Detail::ContainerArgument<NumericArray<T>, MArgumentType::NumericArray, Detail::NumericArraySpec> {};
+
+	template<>
+	struct FunctionArgument<GenericImage> : Detail::ContainerArgument<GenericImage, MArgumentType::Image, Detail::ImageSpec> {};
+
+	template<typename T>
+	struct FunctionArgument<Image<T>> : Detail::ContainerArgument<Image<T>, MArgumentType::Image, Detail::ImageSpec> {};
+
+	template<>
+	struct FunctionArgument<GenericDataList> : Detail::ContainerArgument<GenericDataList, MArgumentType::DataStore, Detail::DataStoreSpec> {};
+
+	template<typename T>
+	struct FunctionArgument<DataList<T>> : Detail::ContainerArgument<DataList<T>, MArgumentType::DataStore, Detail::DataStoreSpec> {};
+
+	template<>
+	struct FunctionArgument<DataVector> : Detail::ContainerArgument<DataVector, MArgumentType::TabularColumn, Detail::TabularColumnSpec> {};
+
+	template<>
+	struct FunctionArgument<void> {
+		static constexpr std::string_view typeSpec = Detail::VoidSpec::value;
+	};
+	/// @endcond
+
+	/**
+	 * @brief   Library function with parameters and return value of C++ types known at compile time.
+	 * @details TypedFunction is the implementation of LLU_TYPED_FUNCTION, which is the intended way of using it.
+	 * @tparam  Signature - type of the C++ function, for example double(const Tensor<double>&, mint)
+	 */
+	template<typename Signature>
+	struct TypedFunction;
+
+	template<typename R, typename... Args>
+	struct TypedFunction<R(Args...)> {
+		/// Type used to read the argument or the result of type T
+		template<typename T>
+		using Traits = FunctionArgument<std::remove_cvref_t<T>>;
+
+		/// Number of arguments of the library function
+		static constexpr std::size_t Arity = sizeof...(Args);
+
+		/// Whether the function can be called on lists of arguments, which requires scalar parameters and a scalar or void result
+		static constexpr bool ListableQ =
+			(Detail::ListableScalar<std::remove_cvref_t<Args>> && ...) && (std::is_void_v<R> || Detail::ListableScalar<std::remove_cvref_t<R>>);
+
+		/**
+		 * @brief   Get the parameter types and the return type of the library function as a Wolfram Language expression.
+		 * @return  a string of the form "{{paramTypes...}, retType}", for example "{{{Real, _}, Integer}, Real}"
+		 */
+		static std::string signature() {
+			std::string params;
+			((params += params.empty() ? "" : ", ", params += Traits<Args>::typeSpec), ...);
+			std::string result {"{{"};
+			result += params;
+			result += "}, ";
+			result += Traits<R>::typeSpec;
+			result += "}";
+			return result;
+		}
+
+		/**
+		 * @brief   Implementation of a LibraryLink function that calls \p F.
+		 * @details The number of arguments is checked once and then every argument is read from the known position in \p args with the known type,
+		 *          without going through MArgumentManager. Exceptions are handled the same way as in LLU_LIBRARY_FUNCTION.
+		 * @tparam  F - C++ function to call
+		 */
+		template<R (*F)(Args...)>
+		static int call(WolframLibraryData libData, mint argc, MArgument* args, MArgument res) noexcept {
+			auto err = ErrorCode::NoError;
+			try {
+				LibraryData::setLibraryData(libData);
+				if (argc != static_cast<mint>(Arity)) {
+					ErrorManager::throwException(ErrorName::MArgumentIndexError);
+				}
+				callImpl<F>(args, res, std::index_sequence_for<Args...> {});
+			} catch (const LibraryLinkError& e) {
+				err = e.which();
+			} catch (...) {
+				err = ErrorCode::FunctionError;
+			}
+			return err;
+		}
+
+		/**
+		 * @brief   Implementation of a LibraryLink function that calls \p F for every row of a list of argument tuples.
+		 * @details Every parameter of \p F is passed as a rank-1 Tensor of Integers, Reals or Complex numbers (Booleans as 0 and 1), or as a rank-1
+		 *          NumericArray if \p NumericArrays is true. NumericArrays whose type differs from Integer64, Real64 or ComplexReal64 (as appropriate
+		 *          for the parameter) are converted first, and the conversion fails if a value cannot be represented exactly. All lists must have the same
+		 *          length, except for lists of length 1, whose only element is used in every row. The last argument is an Integer - maximal number of
+		 *          threads to use, where 0 means the hardware concurrency. Results are returned in a rank-1 container of the same kind as the arguments
+		 *          (Booleans as 0 and 1), unless \p F returns void. Only functions for which ListableQ is true can be called this way.
+		 * @warning \p F must be safe to call concurrently and must not use the LibraryLink API, unless the number of threads is 1.
+		 * @tparam  F - C++ function to call
+		 * @tparam  NumericArrays - whether the lists of arguments and the results are NumericArrays rather than Tensors
+		 */
+		template<R (*F)(Args...), bool NumericArrays = false>
+		static int callListable(WolframLibraryData libData, mint argc, MArgument* args, MArgument res) noexcept {
+			static_assert(ListableQ, "Only functions with scalar parameters and a scalar or void result can be listable.");
+			auto err = ErrorCode::NoError;
+			try {
+				LibraryData::setLibraryData(libData);
+				if (argc != static_cast<mint>(Arity + 1)) {
+					ErrorManager::throwException(ErrorName::MArgumentIndexError);
+				}
+				callListableImpl<F, NumericArrays>(args, res, std::index_sequence_for<Args...> {});
+			} catch (const LibraryLinkError& e) {
+				err = e.which();
+			} catch (...) {
+				err = ErrorCode::FunctionError;
+			}
+			return err;
+		}
+
+		/// Implementation of a LibraryLink function that returns the signature() of the typed function
+		static int signatureFunction(MArgument res) noexcept {
+			try {
+				static const std::string sig = signature();
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): LibraryLink will not modify the string, so const_cast is safe here
+				MArgument_setUTF8String(res, const_cast<char*>(sig.c_str()));
+			} catch (...) {
+				return ErrorCode::FunctionError;
+			}
+			return ErrorCode::NoError;
+		}
+
+	private:
+		template<R (*F)(Args...), std::size_t... Is>
+		static void callImpl(MArgument* args, MArgument& res, std::index_sequence<Is...> /*unused*/) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic): the number of arguments has already been checked
+			std::tuple<typename Traits<Args>::Holder...> holders {args[Is]...};
+			if constexpr (std::is_void_v<R>) {
+				F(Traits<Args>::get(std::get<Is>(holders))...);
+			} else {
+				setResult(res, F(Traits<Args>::get(std::get<Is>(holders))...));
+			}
+		}
+
+		template<R (*F)(Args...), bool NumericArrays, std::size_t... Is>
+		static void callListableImpl(MArgument* args, MArgument& res, std::index_sequence<Is...> /*unused*/) {
+			// NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic): the number of arguments has already been checked
+			std::tuple<Detail::ListableList<NumericArrays, std::remove_cvref_t<Args>>...> lists {
+				Detail::listableArgument<NumericArrays, std::remove_cvref_t<Args>>(args[Is])...};
+			const auto threadCount = static_cast<unsigned>((std::max)(MArgument_getInteger(args[Arity]), mint {0}));
+			// NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+			std::size_t rowCount = 1;
+			((rowCount = std::get<Is>(lists).size() == 1 ? rowCount : static_cast<std::size_t>(std::get<Is>(lists).size())), ...);
+			if (((std::get<Is>(lists).size() != 1 && static_cast<std::size_t>(std::get<Is>(lists).size()) != rowCount) || ...)) {
+				ErrorManager::throwException(NumericArrays ? ErrorName::NumericArraySizeError : ErrorName::TensorSizeError);
+			}
+
+			// data pointers are read here, worker threads only use the columns
+			const std::tuple<Detail::ListableColumn<std::remove_cvref_t<Args>>...> columns {
+				{std::get<Is>(lists).data(), std::get<Is>(lists).size() == 1 ? std::size_t {0} : std::size_t {1}}...};
+			if constexpr (std::is_void_v<R>) {
+				Detail::forEachRange(rowCount, threadCount, [&columns](std::size_t begin, std::size_t end) {
+					for (auto row = begin; row < end; ++row) {
+						F(std::get<Is>(columns)[row]...);
+					}
+				});
+			} else {
+				using Element = Detail::ListableElement<std::remove_cvref_t<R>>;
+				Detail::ListableList<NumericArrays, std::remove_cvref_t<R>> results(Element {}, {static_cast<mint>(rowCount)});
+				auto* out = results.data();
+				Detail::forEachRange(rowCount, threadCount, [&columns, out](std::size_t begin, std::size_t end) {
+					for (auto row = begin; row < end; ++row) {
+						out[row] = static_cast<Element>(F(std::get<Is>(columns)[row]...));
+					}
+				});
+				MArgumentManager mngr {0, nullptr, res};
+				mngr.set(results);
+			}
+		}
+
+		template<typename T>
+		static void setResult(MArgument& res, T&& value) {
+			MArgumentManager mngr {0, nullptr, res};
+			using U = std::remove_cvref_t<T>;
+			if constexpr (std::is_same_v<U, bool>) {
+				mngr.setBoolean(value);
+			} else if constexpr (std::is_integral_v<U>) {
+				mngr.setInteger(static_cast<mint>(value));
+			} else if constexpr (std::is_floating_point_v<U>) {
+				mngr.setReal(static_cast<double>(value));
+			} else {
+				mngr.set(std::forward<T>(value));
+			}
+		}
+	};
+
+}  // namespace LLU
+
+#endif	  // LLU_TYPEDFUNCTION_H
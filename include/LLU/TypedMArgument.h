@@ -107,6 +107,44 @@ namespace LLU::Argument {
 	 */
 	TypedArgument fromMArgument(MArgument m, MArgumentType t);
 
+	/**
+	 * @brief   Get the wrapper of the active member of a plain MArgument when its type is known at compile time.
+	 * @tparam  T - index of the active member of the MArgument m
+	 * @param   m - MArgument
+	 * @return  LLU wrapper of the active member of m, e.g. GenericTensor for MArgumentType::Tensor
+	 * @note    Unlike the non-template overload, this function does not construct a TypedArgument variant, so it is the preferred way
+	 *          of reading values whose type has already been checked.
+	 */
+	template<MArgumentType T>
+	WrapperType<T> fromMArgument(MArgument m) {
+		static_assert(T != MArgumentType::MArgument, "Cannot read MArgument of unknown type.");
+		if constexpr (T == MArgumentType::Boolean) {
+			return static_cast<bool>(MArgument_getBoolean(m));
+		} else if constexpr (T == MArgumentType::Integer) {
+			return MArgument_getInteger(m);
+		} else if constexpr (T == MArgumentType::Real) {
+			return MArgument_getReal(m);
+		} else if constexpr (T == MArgumentType::Complex) {
+			auto* mc = MArgument_getComplexAddress(m);
+			return {mc->ri[0], mc->ri[1]};
+		} else if constexpr (T == MArgumentType::Tensor) {
+			return WrapperType<T> {MArgument_getMTensor(m), Ownership::LibraryLink};
+		} else if constexpr (T == MArgumentType::SparseArray) {
+			return WrapperType<T> {MArgument_getMSparseArray(m), Ownership::LibraryLink};
+		} else if constexpr (T == MArgumentType::NumericArray) {
+			return WrapperType<T> {MArgument_getMNumericArray(m), Ownership::LibraryLink};
+		} else if constexpr (T == MArgumentType::Image) {
+			return WrapperType<T> {MArgument_getMImage(m), Ownership::LibraryLink};
+		} else if constexpr (T == MArgumentType::UTF8String) {
+			return std::string_view {MArgument_getUTF8String(m)};
+		} else if constexpr (T == MArgumentType::DataStore) {
+			//NOLINTNEXTLINE(cppcoreguidelines-pro-type-cstyle-cast): c-style cast used in a macro in WolframIOLibraryFunctions.h
+			return WrapperType<T> {MArgument_getDataStore(m), Ownership::LibraryLink};
+		} else {
+			return WrapperType<T> {MArgument_getTabularColumn(m), Ownership::LibraryLink};
+		}
+	}
+
 	/**
 	 * @brief       Assign current value of given TypedArgument to given MArgument.
 	 * @param[in]   tma - a TypedArgument
@@ -125,7 +163,7 @@ namespace LLU::Argument {
 	template<MArgumentType T>
 	WrapperType<T> toWrapperType(const CType<T>& value) {
 		if constexpr (T == MArgumentType::Complex) {
-			return {value->ri[0], value->ri[1]};
+			return {value.ri[0], value.ri[1]};
 		} else if constexpr (T == MArgumentType::UTF8String) {
 			return {value};
 		} else if constexpr (ContainerTypeQ<T>) {
@@ -0,0 +1,367 @@
+/**
+ * @file	UTFConversion.h
+ * @date	October 19, 2026
+ * @brief	Validating conversions between UTF-8, UTF-16 and UTF-32 strings.
+ */
+#ifndef LLU_UTFCONVERSION_H
+#define LLU_UTFCONVERSION_H
+
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace LLU {
+
+	namespace Detail {
+		/// Throw ErrorName::InvalidUTFSequence for a sequence in \p encoding starting at \p position
+		[[noreturn]] void throwInvalidUTF(const char* encoding, std::size_t position);
+
+		/// Throw ErrorName::UTFBufferTooSmall for a buffer of \p size elements
+		[[noreturn]] void throwUTFBufferTooSmall(std::size_t size);
+
+		/// Get the number of leading ASCII characters in \p text, checking 8 bytes at a time
+		inline std::size_t asciiPrefixLength(std::string_view text) noexcept {
+			constexpr std::uint64_t highBits = 0x8080808080808080ULL;
+			std::size_t i = 0;
+			for (; i + sizeof(std::uint64_t) <= text.size(); i += sizeof(std::uint64_t)) {
+				std::uint64_t word = 0;
+				std::memcpy(&word, text.data() + i, sizeof(word));
+				if ((word & highBits) != 0) {
+					break;
+				}
+			}
+			while (i < text.size() && static_cast<unsigned char>(text[i]) < 0x80U) {
+				++i;
+			}
+			return i;
+		}
+
+		/**
+		 * @brief   Decode a multi-byte UTF-8 sequence, rejecting overlong forms, surrogates and values above U+10FFFF.
+		 * @param   text - UTF-8 text
+		 * @param   i - position of the first byte of the sequence
+		 * @param   codePoint - receives the decoded code point
+		 * @return  length of the sequence, or 0 if the sequence is invalid
+		 */
+		inline std::size_t decodeUTF8(std::string_view text, std::size_t i, char32_t& codePoint) noexcept {
+			const auto byte = [&](std::size_t k) { return static_cast<unsigned char>(text[i + k]); };
+			const auto isContinuation = [&](std::size_t k) { return i + k < text.size() && (byte(k) & 0xC0U) == 0x80U; };
+			const auto lead = byte(0);
+			if (lead >= 0xC2U && lead <= 0xDFU) {
+				if (!isContinuation(1)) {
+					return 0;
+				}
+				codePoint = ((lead & 0x1FU) << 6U) | (byte(1) & 0x3FU);
+				return 2;
+			}
+			if (lead >= 0xE0U && lead <= 0xEFU) {
+				if (!isContinuation(1) || !isContinuation(2)) {
+					return 0;
+				}
+				codePoint = ((lead & 0x0FU) << 12U) | ((byte(1) & 0x3FU) << 6U) | (byte(2) & 0x3FU);
+				return (codePoint < 0x800U || (codePoint >= 0xD800U && codePoint <= 0xDFFFU)) ? 0 : 3;
+			}
+			if (lead >= 0xF0U && lead <= 0xF4U) {
+				if (!isContinuation(1) || !isContinuation(2) || !isContinuation(3)) {
+					return 0;
+				}
+				codePoint = ((lead & 0x07U) << 18U) | ((byte(1) & 0x3FU) << 12U) | ((byte(2) & 0x3FU) << 6U) | (byte(3) & 0x3FU);
+				return (codePoint < 0x10000U || codePoint > 0x10FFFFU) ? 0 : 4;
+			}
+			return 0;
+		}
+
+		/**
+		 * @brief   Walk through UTF-8 text, calling \p ascii for every run of ASCII characters and \p other for every other code point
+		 * @throws  ErrorName::InvalidUTFSequence - if \p text is not valid UTF-8
+		 */
+		template<typename Ascii, typename Other>
+		void forEachUTF8(std::string_view text, Ascii&& ascii, Other&& other) {
+			std::size_t i = 0;
+			while (i < text.size()) {
+				if (const auto run = asciiPrefixLength(text.substr(i)); run > 0) {
+					ascii(text.substr(i, run));
+					i += run;
+					if (i == text.size()) {
+						return;
+					}
+				}
+				char32_t codePoint = 0;
+				const auto length = decodeUTF8(text, i, codePoint);
+				if (length == 0) {
+					throwInvalidUTF("UTF-8", i);
+				}
+				other(codePoint);
+				i += length;
+			}
+		}
+
+		/**
+		 * @brief   Walk through UTF-16 text, calling \p f for every code point
+		 * @throws  ErrorName::InvalidUTFSequence - if \p text contains unpaired surrogates or values which do not fit in 16 bits
+		 */
+		template<typename T, typename F>
+		void forEachUTF16(std::basic_string_view<T> text, F&& f) {
+			for (std::size_t i = 0; i < text.size(); ++i) {
+				const auto unit = static_cast<std::uint32_t>(text[i]);
+				if (unit < 0xD800U || (unit > 0xDFFFU && unit <= 0xFFFFU)) {
+					f(static_cast<char32_t>(unit));
+					continue;
+				}
+				const auto next = i + 1 < text.size() ? static_cast<std::uint32_t>(text[i + 1]) : 0U;
+				if (unit > 0xDBFFU || next < 0xDC00U || next > 0xDFFFU) {
+					throwInvalidUTF("UTF-16", i);
+				}
+				f(static_cast<char32_t>(0x10000U + ((unit - 0xD800U) << 10U) + (next - 0xDC00U)));
+				++i;
+			}
+		}
+
+		/**
+		 * @brief   Walk through UTF-32 text, calling \p f for every code point
+		 * @throws  ErrorName::InvalidUTFSequence - if \p text contains surrogates or values above U+10FFFF
+		 */
+		template<typename T, typename F>
+		void forEachUTF32(std::basic_string_view<T> text, F&& f) {
+			for (std::size_t i = 0; i < text.size(); ++i) {
+				const auto codePoint = static_cast<std::uint32_t>(text[i]);
+				if (codePoint > 0x10FFFFU || (codePoint >= 0xD800U && codePoint <= 0xDFFFU)) {
+					throwInvalidUTF("UTF-32", i);
+				}
+				f(static_cast<char32_t>(codePoint));
+			}
+		}
+
+		/// Get the number of bytes needed to encode a code point in UTF-8
+		constexpr std::size_t utf8Length(char32_t codePoint) noexcept {
+			return codePoint < 0x80U ? 1 : (codePoint < 0x800U ? 2 : (codePoint < 0x10000U ? 3 : 4));
+		}
+
+		/// Encode a valid code point in UTF-8 at the beginning of \p out, the length of \p out must be at least utf8Length(codePoint)
+		inline void encodeUTF8(char32_t codePoint, char* out) noexcept {
+			const auto cp = static_cast<std::uint32_t>(codePoint);
+			const auto continuation = [](std::uint32_t bits) { return static_cast<char>(0x80U | (bits & 0x3FU)); };
+			if (cp < 0x80U) {
+				out[0] = static_cast<char>(cp);
+			} else if (cp < 0x800U) {
+				out[0] = static_cast<char>(0xC0U | (cp >> 6U));
+				out[1] = continuation(cp);
+			} else if (cp < 0x10000U) {
+				out[0] = static_cast<char>(0xE0U | (cp >> 12U));
+				out[1] = continuation(cp >> 6U);
+				out[2] = continuation(cp);
+			} else {
+				out[0] = static_cast<char>(0xF0U | (cp >> 18U));
+				out[1] = continuation(cp >> 12U);
+				out[2] = continuation(cp >> 6U);
+				out[3] = continuation(cp);
+			}
+		}
+
+		/// Encode code points from \p forEach in UTF-8 into \p destination, return the number of bytes written
+		template<typename ForEach>
+		std::size_t writeUTF8(std::span<char> destination, ForEach&& forEach) {
+			std::size_t written = 0;
+			forEach([&](char32_t codePoint) {
+				const auto length = utf8Length(codePoint);
+				if (written + length > destination.size()) {
+					throwUTFBufferTooSmall(destination.size());
+				}
+				encodeUTF8(codePoint, destination.data() + written);
+				written += length;
+			});
+			return written;
+		}
+
+		/// Copy a run of ASCII characters to a buffer of wider code units
+		template<typename T>
+		void widenASCII(std::string_view run, std::span<T> destination, std::size_t& written) {
+			if (written + run.size() > destination.size()) {
+				throwUTFBufferTooSmall(destination.size());
+			}
+			for (auto c : run) {
+				destination[written++] = static_cast<T>(c);
+			}
+		}
+	}  // namespace Detail
+
+	/**
+	 * @brief   Get the number of UTF-16 code units needed to represent UTF-8 text.
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-8
+	 */
+	std::size_t utf16Length(std::string_view source);
+
+	/**
+	 * @brief   Get the number of UTF-32 code units (code points) in UTF-8 text.
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-8
+	 */
+	std::size_t utf32Length(std::string_view source);
+
+	/**
+	 * @brief   Get the number of bytes needed to represent UTF-16 text in UTF-8.
+	 * @tparam  T - character type of the UTF-16 string, each element holds a single UTF-16 code unit
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-16
+	 */
+	template<typename T>
+	std::size_t utf8LengthFromUTF16(std::basic_string_view<T> source) {
+		std::size_t length = 0;
+		Detail::forEachUTF16(source, [&](char32_t codePoint) { length += Detail::utf8Length(codePoint); });
+		return length;
+	}
+
+	/**
+	 * @brief   Get the number of bytes needed to represent UTF-32 text in UTF-8.
+	 * @tparam  T - character type of the UTF-32 string
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-32
+	 */
+	template<typename T>
+	std::size_t utf8LengthFromUTF32(std::basic_string_view<T> source) {
+		std::size_t length = 0;
+		Detail::forEachUTF32(source, [&](char32_t codePoint) { length += Detail::utf8Length(codePoint); });
+		return length;
+	}
+
+	/**
+	 * @brief   Convert UTF-8 text to UTF-16 into a given buffer.
+	 * @tparam  T - character type for the result, supported types are char16_t, char32_t, or wchar_t
+	 * @param   source - string in UTF-8 encoding
+	 * @param   destination - buffer for the result, utf16Length(source) elements are enough
+	 * @return  number of UTF-16 code units written
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-8
+	 * @throws  ErrorName::UTFBufferTooSmall - if \p destination is too small
+	 */
+	template<typename T>
+	std::size_t fromUTF8toUTF16(std::string_view source, std::span<T> destination) {
+		std::size_t written = 0;
+		Detail::forEachUTF8(
+			source, [&](std::string_view run) { Detail::widenASCII(run, destination, written); },
+			[&](char32_t codePoint) {
+				const std::size_t units = codePoint > 0xFFFFU ? 2 : 1;
+				if (written + units > destination.size()) {
+					Detail::throwUTFBufferTooSmall(destination.size());
+				}
+				if (units == 1) {
+					destination[written++] = static_cast<T>(codePoint);
+				} else {
+					const auto offset = static_cast<std::uint32_t>(codePoint) - 0x10000U;
+					destination[written++] = static_cast<T>(0xD800U + (offset >> 10U));
+					destination[written++] = static_cast<T>(0xDC00U + (offset & 0x3FFU));
+				}
+			});
+		return written;
+	}
+
+	/**
+	 * @brief   Convert UTF-8 text to UTF-32 into a given buffer.
+	 * @tparam  T - character type for the result
+	 * @param   source - string in UTF-8 encoding
+	 * @param   destination - buffer for the result, utf32Length(source) elements are enough
+	 * @return  number of code points written
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-8
+	 * @throws  ErrorName::UTFBufferTooSmall - if \p destination is too small
+	 */
+	template<typename T>
+	std::size_t fromUTF8toUTF32(std::string_view source, std::span<T> destination) {
+		std::size_t written = 0;
+		Detail::forEachUTF8(
+			source, [&](std::string_view run) { Detail::widenASCII(run, destination, written); },
+			[&](char32_t codePoint) {
+				if (written == destination.size()) {
+					Detail::throwUTFBufferTooSmall(destination.size());
+				}
+				destination[written++] = static_cast<T>(codePoint);
+			});
+		return written;
+	}
+
+	/**
+	 * @brief   Convert UTF-16 text to UTF-8 into a given buffer.
+	 * @tparam  T - character type of the UTF-16 string, each element holds a single UTF-16 code unit
+	 * @param   source - string in UTF-16 encoding
+	 * @param   destination - buffer for the result, utf8LengthFromUTF16(source) bytes are enough
+	 * @return  number of bytes written
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-16
+	 * @throws  ErrorName::UTFBufferTooSmall - if \p destination is too small
+	 */
+	template<typename T>
+	std::size_t fromUTF16toUTF8(std::basic_string_view<T> source, std::span<char> destination) {
+		return Detail::writeUTF8(destination, [&](auto&& f) { Detail::forEachUTF16(source, f); });
+	}
+
+	/**
+	 * @brief   Convert UTF-32 text to UTF-8 into a given buffer.
+	 * @tparam  T - character type of the UTF-32 string
+	 * @param   source - string in UTF-32 encoding
+	 * @param   destination - buffer for the result, utf8LengthFromUTF32(source) bytes are enough
+	 * @return  number of bytes written
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-32
+	 * @throws  ErrorName::UTFBufferTooSmall - if \p destination is too small
+	 */
+	template<typename T>
+	std::size_t fromUTF32toUTF8(std::basic_string_view<T> source, std::span<char> destination) {
+		return Detail::writeUTF8(destination, [&](auto&& f) { Detail::forEachUTF32(source, f); });
+	}
+
+	/**
+	 * Convert string from UTF8 to UTF16.
+	 * @tparam	T - character type for the result, supported types are char16_t, char32_t, or wchar_t
+	 * @param	source - string in UTF8 encoding
+	 * @return  copy of the input string converted to UTF16
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-8
+	 */
+	template<typename T>
+	std::basic_string<T> fromUTF8toUTF16(const std::string& source) {
+		std::basic_string<T> result(utf16Length(source), T {});
+		fromUTF8toUTF16(std::string_view {source}, std::span {result});
+		return result;
+	}
+
+	/**
+	 * Convert string from UTF16 to UTF8.
+	 * @tparam  T - character type of the UTF16 string, supported types are char16_t, char32_t, or wchar_t
+	 * @param   source - string in UTF16 encoding
+	 * @return  copy of the input string converted to UTF8
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-16
+	 */
+	template<typename T>
+	std::string fromUTF16toUTF8(const std::basic_string<T>& source) {
+		const std::basic_string_view<T> view {source};
+		std::string result(utf8LengthFromUTF16(view), '\0');
+		fromUTF16toUTF8(view, std::span {result});
+		return result;
+	}
+
+	/**
+	 * Convert string from UTF8 to UTF32.
+	 * @tparam  T - character type for the result
+	 * @param   source - string in UTF8 encoding
+	 * @return  copy of the input string converted to UTF32
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-8
+	 */
+	template<typename T>
+	std::basic_string<T> fromUTF8toUTF32(const std::string& source) {
+		std::basic_string<T> result(utf32Length(source), T {});
+		fromUTF8toUTF32(std::string_view {source}, std::span {result});
+		return result;
+	}
+
+	/**
+	 * Convert string from UTF32 to UTF8.
+	 * @tparam  T - character type of the UTF32 string
+	 * @param   source - string in UTF32 encoding
+	 * @return  copy of the input string converted to UTF8
+	 * @throws  ErrorName::InvalidUTFSequence - if \p source is not valid UTF-32
+	 */
+	template<typename T>
+	std::string fromUTF32toUTF8(const std::basic_string<T>& source) {
+		const std::basic_string_view<T> view {source};
+		std::string result(utf8LengthFromUTF32(view), '\0');
+		fromUTF32toUTF8(view, std::span {result});
+		return result;
+	}
+
+}  // namespace LLU
+
+#endif	  // LLU_UTFCONVERSION_H
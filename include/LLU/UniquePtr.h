@@ -26,7 +26,7 @@ namespace LLU {
 			Deleter(const Deleter<U>& /*other*/) noexcept {}
 
 			void operator()(pointer p) {
-				LibraryData::API()->WL_free(p);
+				LibraryData::API()->WL_free(const_cast<std::remove_cv_t<T>*>(p));
 			}
 		};
 
@@ -41,7 +41,7 @@ namespace LLU {
 
 			template<typename U, typename = typename std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>>>
 			void operator()(U* p) {
-				LibraryData::API()->WL_free(p);
+				LibraryData::API()->WL_free(const_cast<std::remove_cv_t<U>*>(p));
 			}
 		};
 	}	 // namespace detail
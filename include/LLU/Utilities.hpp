@@ -302,6 +302,32 @@ namespace LLU {
 	inline constexpr mint TensorType<std::complex<double>> = MType_Complex;
 	/// @endcond
 
+	/**
+	 * @brief   Compile-time list of types, used to limit the set of element types for which generic code is instantiated
+	 * @tparam  Ts - any number of types
+	 */
+	template<typename... Ts>
+	struct TypeList {};
+
+	/// All types of NumericArray elements
+	using NumericArrayTypes = TypeList<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, float,
+									   double, std::complex<float>, std::complex<double>>;
+
+	/// Signed and unsigned integer types of NumericArray elements
+	using IntegerTypes = TypeList<std::int8_t, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t, std::uint32_t, std::int64_t, std::uint64_t>;
+
+	/// Real floating-point types of NumericArray elements
+	using RealTypes = TypeList<float, double>;
+
+	/// Complex types of NumericArray elements
+	using ComplexTypes = TypeList<std::complex<float>, std::complex<double>>;
+
+	/// All types of Tensor elements
+	using TensorTypes = TypeList<mint, double, std::complex<double>>;
+
+	/// All types of Image elements
+	using ImageTypes = TypeList<std::int8_t, std::uint8_t, std::uint16_t, float, double>;
+
 } /* namespace LLU */
 
 #endif	  // LLU_UTILITIES_HPP
@@ -7,9 +7,9 @@
 #ifndef LLU_WSTP_GET_H_
 #define LLU_WSTP_GET_H_
 
-#include <functional>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 #include "wstp.h"
 
@@ -32,268 +32,104 @@ namespace LLU::WS {
 	template<typename T>
 	using ArrayData = std::unique_ptr<T[], ReleaseArray<T>>;
 
+	/// @cond
+	namespace Detail {
+		/**
+		 * @brief   WSTP functions that read data of type T, resolved at compile time.
+		 * @details The primary template only triggers compilation errors, it is specialized for each type supported by WSTP.
+		 */
+		template<typename T>
+		struct GetFunctions {
+			static int Array(WSLINK /*link*/, T** /*rawResult*/, int** /*dims*/, char*** /*heads*/, int* /*rank*/) {
+				static_assert(dependent_false_v<T>, "Trying to use WS::GetArray<T> for unsupported type T");
+				return 0;
+			}
+
+			static int List(WSLINK /*link*/, T** /*rawResult*/, int* /*length*/) {
+				static_assert(dependent_false_v<T>, "Trying to use WS::GetList<T> for unsupported type T");
+				return 0;
+			}
+
+			static int Scalar(WSLINK /*link*/, T* /*result*/) {
+				static_assert(dependent_false_v<T>, "Trying to use WS::GetScalar<T> for unsupported type T");
+				return 0;
+			}
+
+			static inline const std::string ArrayName;
+			static inline const std::string ListName;
+			static inline const std::string ScalarName;
+		};
+
+/// Macro for defining WSTP functions that read data of type T, \p WSType is the name of the type in WSTP functions, e.g. Integer32 for int.
+/// For internal use only.
+#define WS_GET_DEFINE_FUNCTIONS(T, WSType)                                      \
+	template<>                                                                 \
+	struct GetFunctions<T> {                                                   \
+		static constexpr auto Array = WSGet##WSType##Array;                    \
+		static constexpr auto List = WSGet##WSType##List;                      \
+		static constexpr auto Scalar = WSGet##WSType;                          \
+		static inline const std::string ArrayName {"WSGet" #WSType "Array"};   \
+		static inline const std::string ListName {"WSGet" #WSType "List"};     \
+		static inline const std::string ScalarName {"WSGet" #WSType};          \
+	};
+
+		WS_GET_DEFINE_FUNCTIONS(unsigned char, Integer8)
+		WS_GET_DEFINE_FUNCTIONS(short, Integer16)
+		WS_GET_DEFINE_FUNCTIONS(int, Integer32)
+		WS_GET_DEFINE_FUNCTIONS(wsint64, Integer64)
+		WS_GET_DEFINE_FUNCTIONS(float, Real32)
+		WS_GET_DEFINE_FUNCTIONS(double, Real64)
+
+#undef WS_GET_DEFINE_FUNCTIONS
+	}  // namespace Detail
+	/// @endcond
+
 	template<typename T>
 	struct GetArray {
-		using Func = std::function<int(WSLINK, T**, int**, char***, int*)>;
+		using Func = std::decay_t<decltype(Detail::GetFunctions<T>::Array)>;
 
 		static ArrayData<T> get(WSLINK m) {
 			T* rawResult {};
 			int* dims {};
 			char** heads {};
 			int rank {};
-			Detail::checkError(m, ArrayF(m, &rawResult, &dims, &heads, &rank), ErrorName::WSGetArrayError, ArrayFName);
+			Detail::checkError(m, Functions::Array(m, &rawResult, &dims, &heads, &rank), ErrorName::WSGetArrayError, Functions::ArrayName);
 			return {rawResult, ReleaseArray<T> {m, dims, heads, rank}};
 		}
 
 	private:
-		static const std::string ArrayFName;
-		static Func ArrayF;
+		using Functions = Detail::GetFunctions<T>;
 	};
 
 	template<typename T>
 	struct GetList {
-		using Func = std::function<int(WSLINK, T**, int*)>;
+		using Func = std::decay_t<decltype(Detail::GetFunctions<T>::List)>;
 
 		static ListData<T> get(WSLINK m) {
 			T* rawResult {};
 			int len {};
-			Detail::checkError(m, ListF(m, &rawResult, &len), ErrorName::WSGetListError, ListFName);
+			Detail::checkError(m, Functions::List(m, &rawResult, &len), ErrorName::WSGetListError, Functions::ListName);
 			return {rawResult, ReleaseList<T> {m, len}};
 		}
 
 	private:
-		static const std::string ListFName;
-		static Func ListF;
+		using Functions = Detail::GetFunctions<T>;
 	};
 
 	template<typename T>
 	struct GetScalar {
-		using Func = std::function<int(WSLINK, T*)>;
+		using Func = std::decay_t<decltype(Detail::GetFunctions<T>::Scalar)>;
 
 		static T get(WSLINK m) {
 			T rawResult;
-			Detail::checkError(m, ScalarF(m, &rawResult), ErrorName::WSGetScalarError, ScalarFName);
+			Detail::checkError(m, Functions::Scalar(m, &rawResult), ErrorName::WSGetScalarError, Functions::ScalarName);
 			return rawResult;
 		}
 
 	private:
-		static const std::string ScalarFName;
-		static Func ScalarF;
-	};
-
-	template<typename T>
-	typename GetArray<T>::Func GetArray<T>::ArrayF = [](WSLINK /*link*/, T** /*rawResult*/, int** /*dims*/, char*** /*heads*/, int* /*rank*/) {
-		static_assert(dependent_false_v<T>, "Trying to use WS::GetArray<T> for unsupported type T");
-		return 0;
-	};
-
-	template<typename T>
-	typename GetList<T>::Func GetList<T>::ListF = [](WSLINK /*link*/) {
-		static_assert(dependent_false_v<T>, "Trying to use WS::GetList<T> for unsupported type T");
-		return 0;
+		using Functions = Detail::GetFunctions<T>;
 	};
 
-	template<typename T>
-	typename GetScalar<T>::Func GetScalar<T>::ScalarF = [](WSLINK /*link*/, T* /*result*/) {
-		static_assert(dependent_false_v<T>, "Trying to use WS::GetScalar<T> for unsupported type T");
-		return 0;
-	};
-
-/// @cond
-#ifndef _WIN32
-
-#define WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(T) \
-	template<>                                              \
-	GetArray<T>::Func GetArray<T>::ArrayF;                  \
-	template<>                                              \
-	const std::string GetArray<T>::ArrayFName;              \
-	template<>                                              \
-	GetList<T>::Func GetList<T>::ListF;                     \
-	template<>                                              \
-	const std::string GetList<T>::ListFName;                \
-	template<>                                              \
-	GetScalar<T>::Func GetScalar<T>::ScalarF;               \
-	template<>                                              \
-	const std::string GetScalar<T>::ScalarFName;
-
-	WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(unsigned char)
-	WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(short)
-	WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(int)
-	WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(wsint64)
-	WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(float)
-	WS_GET_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(double)
-
-#else
-
-	/* ***************************************************************** */
-	/* ********* Template specializations for  unsigned char  ********** */
-	/* ***************************************************************** */
-
-	/* GetArray */
-
-	template<>
-	GetArray<unsigned char>::Func GetArray<unsigned char>::ArrayF = WSGetInteger8Array;
-
-	template<>
-	const std::string GetArray<unsigned char>::ArrayFName = "WSGetInteger8Array";
-
-	/* GetList */
-
-	template<>
-	GetList<unsigned char>::Func GetList<unsigned char>::ListF = WSGetInteger8List;
-
-	template<>
-	const std::string GetList<unsigned char>::ListFName = "WSGetInteger8List";
-
-	/* GetScalar */
-
-	template<>
-	GetScalar<unsigned char>::Func GetScalar<unsigned char>::ScalarF = WSGetInteger8;
-
-	template<>
-	const std::string GetScalar<unsigned char>::ScalarFName = "WSGetInteger8";
-
-	/* ***************************************************************** */
-	/* ******* Template specializations for  (unsigned) short  ********* */
-	/* ***************************************************************** */
-
-	/* GetArray */
-
-	template<>
-	GetArray<short>::Func GetArray<short>::ArrayF = WSGetInteger16Array;
-
-	template<>
-	const std::string GetArray<short>::ArrayFName = "WSGetInteger16Array";
-
-	/* GetList */
-
-	template<>
-	GetList<short>::Func GetList<short>::ListF = WSGetInteger16List;
-
-	template<>
-	const std::string GetList<short>::ListFName = "WSGetInteger16List";
-
-	/* GetScalar */
-
-	template<>
-	GetScalar<short>::Func GetScalar<short>::ScalarF = WSGetInteger16;
-
-	template<>
-	const std::string GetScalar<short>::ScalarFName = "WSGetInteger16";
-
-	/* ***************************************************************** */
-	/* ******** Template specializations for  (unsigned) int  ********** */
-	/* ***************************************************************** */
-
-	/* GetArray */
-
-	template<>
-	GetArray<int>::Func GetArray<int>::ArrayF = WSGetInteger32Array;
-
-	template<>
-	const std::string GetArray<int>::ArrayFName = "WSGetInteger32Array";
-
-	/* GetList */
-
-	template<>
-	GetList<int>::Func GetList<int>::ListF = WSGetInteger32List;
-
-	template<>
-	const std::string GetList<int>::ListFName = "WSGetInteger32List";
-
-	/* GetScalar */
-
-	template<>
-	GetScalar<int>::Func GetScalar<int>::ScalarF = WSGetInteger32;
-
-	template<>
-	const std::string GetScalar<int>::ScalarFName = "WSGetInteger32";
-
-	/* ***************************************************************** */
-	/* *********** Template specializations for  wsint64  ************** */
-	/* ***************************************************************** */
-
-	/* GetArray */
-
-	template<>
-	GetArray<wsint64>::Func GetArray<wsint64>::ArrayF = WSGetInteger64Array;
-
-	template<>
-	const std::string GetArray<wsint64>::ArrayFName = "WSGetInteger64Array";
-
-	/* GetList */
-
-	template<>
-	GetList<wsint64>::Func GetList<wsint64>::ListF = WSGetInteger64List;
-
-	template<>
-	const std::string GetList<wsint64>::ListFName = "WSGetInteger64List";
-
-	/* GetScalar */
-
-	template<>
-	GetScalar<wsint64>::Func GetScalar<wsint64>::ScalarF = WSGetInteger64;
-
-	template<>
-	const std::string GetScalar<wsint64>::ScalarFName = "WSGetInteger64";
-
-	/* ***************************************************************** */
-	/* ************ Template specializations for  float  *************** */
-	/* ***************************************************************** */
-
-	/* GetArray */
-
-	template<>
-	GetArray<float>::Func GetArray<float>::ArrayF = WSGetReal32Array;
-
-	template<>
-	const std::string GetArray<float>::ArrayFName = "WSGetReal32Array";
-
-	/* GetList */
-
-	template<>
-	GetList<float>::Func GetList<float>::ListF = WSGetReal32List;
-
-	template<>
-	const std::string GetList<float>::ListFName = "WSGetReal32List";
-
-	/* GetScalar */
-
-	template<>
-	GetScalar<float>::Func GetScalar<float>::ScalarF = WSGetReal32;
-
-	template<>
-	const std::string GetScalar<float>::ScalarFName = "WSGetReal32";
-
-	/* ***************************************************************** */
-	/* *********** Template specializations for  double  *************** */
-	/* ***************************************************************** */
-
-	/* GetArray */
-
-	template<>
-	GetArray<double>::Func GetArray<double>::ArrayF = WSGetReal64Array;
-
-	template<>
-	const std::string GetArray<double>::ArrayFName = "WSGetReal64Array";
-
-	/* GetList */
-
-	template<>
-	GetList<double>::Func GetList<double>::ListF = WSGetReal64List;
-
-	template<>
-	const std::string GetList<double>::ListFName = "WSGetReal64List";
-
-	/* GetScalar */
-
-	template<>
-	GetScalar<double>::Func GetScalar<double>::ScalarF = WSGetReal64;
-
-	template<>
-	const std::string GetScalar<double>::ScalarFName = "WSGetReal64";
-#endif
-/// @endcond
 } /* namespace LLU::WS */
 
 #endif /* LLU_WSTP_GET_H_ */
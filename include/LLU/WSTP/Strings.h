@@ -7,9 +7,9 @@
 #ifndef LLU_WSTP_STRINGS_H_
 #define LLU_WSTP_STRINGS_H_
 
-#include <algorithm>
-#include <functional>
 #include <memory>
+#include <span>
+#include <string>
 
 #include "wstp.h"
 
@@ -44,41 +44,160 @@ namespace LLU::WS {
 
 	/// GetStringFuncT is a type of WSTP function that reads string from a link, e.g. WSGetByteString
 	template<typename T>
-	using GetStringFuncT = std::function<int(WSLINK, const T**, int*, int*)>;
+	using GetStringFuncT = int (*)(WSLINK, const T**, int*, int*);
 
 	/// PutStringFuncT is a type of WSTP function that sends string data to a link, e.g. WSPutByteString
 	template<typename T>
-	using PutStringFuncT = std::function<int(WSLINK, const T*, int)>;
+	using PutStringFuncT = int (*)(WSLINK, const T*, int);
 
 	/// ReleaseStringFuncT is a type of WSTP function to release string data allocated by WSTP, e.g. WSReleaseByteString
 	template<typename T>
-	using ReleaseStringFuncT = std::function<void(WSLINK, const T*, int)>;
+	using ReleaseStringFuncT = void (*)(WSLINK, const T*, int);
+
+	/// @cond
+	namespace Detail {
+		/// Check if a string contains only ASCII characters
+		inline bool isASCII(const unsigned char* strData, int len) noexcept {
+			constexpr unsigned char maxValidASCII = 127;
+			unsigned char allBits = 0;
+			// no early exit, so that the loop can be vectorized
+			for (auto c : std::span {strData, static_cast<std::size_t>(len)}) {
+				allBits |= c;
+			}
+			return allBits <= maxValidASCII;
+		}
+
+		/**
+		 * @brief   WSTP functions that read, send and release strings in encoding E, resolved at compile time.
+		 * @details Functions which do not report the length of the string in bytes or characters set it to -1.
+		 */
+		template<Encoding E>
+		struct StringFunctions;
+
+		template<>
+		struct StringFunctions<Encoding::Native> {
+			static int get(WSLINK m, const char** strData, int* len, int* charCnt) {
+				*len = *charCnt = -1;
+				return WSGetString(m, strData);
+			}
+			static int put(WSLINK m, const char* strData, int /*length*/) {
+				return WSPutString(m, strData);
+			}
+			static void release(WSLINK m, const char* strData, int /*length*/) {
+				WSReleaseString(m, strData);
+			}
+			static inline const std::string GetFName {"WSGetString"};
+			static inline const std::string PutFName {"WSPutString"};
+		};
+
+		template<>
+		struct StringFunctions<Encoding::Byte> {
+			static int get(WSLINK m, const unsigned char** strData, int* len, int* charCnt) {
+				*charCnt = -1;
+				return WSGetByteString(m, strData, len, EncodingConfig::substituteCodeForByteEncoding);
+			}
+			static int put(WSLINK m, const unsigned char* strData, int len) {
+				return WSPutByteString(m, strData, len);
+			}
+			static void release(WSLINK m, const unsigned char* strData, int len) {
+				WSReleaseByteString(m, strData, len);
+			}
+			static inline const std::string GetFName {"WSGetByteString"};
+			static inline const std::string PutFName {"WSPutByteString"};
+		};
+
+		template<>
+		struct StringFunctions<Encoding::UTF8> {
+			static int get(WSLINK m, const unsigned char** strData, int* len, int* charCnt) {
+				return WSGetUTF8String(m, strData, len, charCnt);
+			}
+			static int put(WSLINK m, const unsigned char* strData, int len) {
+				if (EncodingConfig::useFastUTF8 && isASCII(strData, len)) {
+					return WSPutByteString(m, strData, len);
+				}
+				return WSPutUTF8String(m, strData, len);
+			}
+			static void release(WSLINK m, const unsigned char* strData, int len) {
+				WSReleaseUTF8String(m, strData, len);
+			}
+			static inline const std::string GetFName {"WSGetUTF8String"};
+			static inline const std::string PutFName {"WSPut(UTF8/Byte)String"};
+		};
+
+		template<>
+		struct StringFunctions<Encoding::UTF16> {
+			static int get(WSLINK m, const unsigned short** strData, int* len, int* charCnt) {
+				return WSGetUTF16String(m, strData, len, charCnt);
+			}
+			static int put(WSLINK m, const unsigned short* strData, int len) {
+				return WSPutUTF16String(m, strData, len);
+			}
+			static void release(WSLINK m, const unsigned short* strData, int len) {
+				WSReleaseUTF16String(m, strData, len);
+			}
+			static inline const std::string GetFName {"WSGetUTF16String"};
+			static inline const std::string PutFName {"WSPutUTF16String"};
+		};
+
+		template<>
+		struct StringFunctions<Encoding::UCS2> {
+			static int get(WSLINK m, const unsigned short** strData, int* len, int* charCnt) {
+				*charCnt = -1;
+				return WSGetUCS2String(m, strData, len);
+			}
+			static int put(WSLINK m, const unsigned short* strData, int len) {
+				return WSPutUCS2String(m, strData, len);
+			}
+			static void release(WSLINK m, const unsigned short* strData, int len) {
+				WSReleaseUCS2String(m, strData, len);
+			}
+			static inline const std::string GetFName {"WSGetUCS2String"};
+			static inline const std::string PutFName {"WSPutUCS2String"};
+		};
+
+		template<>
+		struct StringFunctions<Encoding::UTF32> {
+			static int get(WSLINK m, const unsigned int** strData, int* len, int* charCnt) {
+				*charCnt = -1;
+				return WSGetUTF32String(m, strData, len);
+			}
+			static int put(WSLINK m, const unsigned int* strData, int len) {
+				return WSPutUTF32String(m, strData, len);
+			}
+			static void release(WSLINK m, const unsigned int* strData, int len) {
+				WSReleaseUTF32String(m, strData, len);
+			}
+			static inline const std::string GetFName {"WSGetUTF32String"};
+			static inline const std::string PutFName {"WSPutUTF32String"};
+		};
+	}  // namespace Detail
+	/// @endcond
 
 	template<Encoding E>
 	struct String {
 
 		using CharT = CharType<E>;
 
-		static GetStringFuncT<CharT> Get;
-		static PutStringFuncT<CharT> Put;
-		static ReleaseStringFuncT<CharT> Release;
+		static constexpr GetStringFuncT<CharT> Get = Detail::StringFunctions<E>::get;
+		static constexpr PutStringFuncT<CharT> Put = Detail::StringFunctions<E>::put;
+		static constexpr ReleaseStringFuncT<CharT> Release = Detail::StringFunctions<E>::release;
 
-		static const std::string GetFName;
-		static const std::string PutFName;
+		static inline const std::string& GetFName = Detail::StringFunctions<E>::GetFName;
+		static inline const std::string& PutFName = Detail::StringFunctions<E>::PutFName;
 
 		template<typename T>
 		static void put(WSLINK m, const T* string, int len) {
 			static_assert(CharacterTypesCompatible<E, T>, "Character type does not match the encoding in WS::String<E>::put");
 			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): sorry :(
 			auto* expectedStr = reinterpret_cast<const CharT*>(string);
-			Detail::checkError(m, Put(m, expectedStr, len), ErrorName::WSPutStringError, PutFName);
+			Detail::checkError(m, Detail::StringFunctions<E>::put(m, expectedStr, len), ErrorName::WSPutStringError, PutFName);
 		}
 
 		static StringData<E> get(WSLINK m) {
 			const CharT* rawResult {};
 			int bytes {};
 			int characters {};
-			Detail::checkError(m, Get(m, &rawResult, &bytes, &characters), ErrorName::WSGetStringError, GetFName);
+			Detail::checkError(m, Detail::StringFunctions<E>::get(m, &rawResult, &bytes, &characters), ErrorName::WSGetStringError, GetFName);
 			return {rawResult, ReleaseString<E> {m, bytes, characters}};
 		}
 
@@ -131,7 +250,7 @@ namespace LLU::WS {
 		ReleaseString(WSLINK m, int l, int c) : m(m), length(l), chars(c) {}
 
 		void operator()(const CharType<E>* data) {
-			String<E>::Release(m, data, length);
+			Detail::StringFunctions<E>::release(m, data, length);
 		}
 
 		int getLength() const {
@@ -148,125 +267,6 @@ namespace LLU::WS {
 		int chars = 0;
 	};
 
-/// @cond
-#ifndef _WIN32
-
-/// Macro for declaring specializations of static members for WS::String<Encoding::E>
-/// For internal use only.
-#define WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(E)              \
-	template<>                                                              \
-	GetStringFuncT<CharType<Encoding::E>> String<Encoding::E>::Get;         \
-	template<>                                                              \
-	PutStringFuncT<CharType<Encoding::E>> String<Encoding::E>::Put;         \
-	template<>                                                              \
-	ReleaseStringFuncT<CharType<Encoding::E>> String<Encoding::E>::Release; \
-	template<>                                                              \
-	const std::string String<Encoding::E>::GetFName;                        \
-	template<>                                                              \
-	const std::string String<Encoding::E>::PutFName;
-
-	WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(Native)
-	WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(Byte)
-	WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(UTF8)
-	WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(UTF16)
-	WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(UCS2)
-	WS_STRING_DECLARE_SPECIALIZATIONS_OF_STATIC_MEMBERS(UTF32)
-
-#else
-
-	template<>
-	GetStringFuncT<CharType<Encoding::Native>> String<Encoding::Native>::Get = [](WSLINK m, const char** strData, int* len, int* charCnt) {
-		*len = *charCnt = -1;
-		return WSGetString(m, strData);
-	};
-	template<>
-	PutStringFuncT<CharType<Encoding::Native>> String<Encoding::Native>::Put = [](WSLINK m, const char* strData, int) { return WSPutString(m, strData); };
-	template<>
-	ReleaseStringFuncT<CharType<Encoding::Native>> String<Encoding::Native>::Release = [](WSLINK m, const char* strData, int) { WSReleaseString(m, strData); };
-	template<>
-	const std::string String<Encoding::Native>::GetFName = "WSGetString";
-	template<>
-	const std::string String<Encoding::Native>::PutFName = "WSPutString";
-
-	template<>
-	GetStringFuncT<CharType<Encoding::Byte>> String<Encoding::Byte>::Get = [](WSLINK m, const unsigned char** strData, int* len, int* charCnt) {
-		*charCnt = -1;
-		return WSGetByteString(m, strData, len, EncodingConfig::substituteCodeForByteEncoding);
-	};
-	template<>
-	PutStringFuncT<CharType<Encoding::Byte>> String<Encoding::Byte>::Put = WSPutByteString;
-	template<>
-	ReleaseStringFuncT<CharType<Encoding::Byte>> String<Encoding::Byte>::Release = WSReleaseByteString;
-	template<>
-	const std::string String<Encoding::Byte>::GetFName = "WSGetByteString";
-	template<>
-	const std::string String<Encoding::Byte>::PutFName = "WSPutByteString";
-
-	namespace {
-		// Nested lambdas are too much for MSVC, so we define this helper function separately
-		bool allASCIIQ(const unsigned char* strData, int len) {
-			return std::all_of(strData, strData + len, [](unsigned char c) -> bool { return c <= 127; });
-		}
-	}
-
-	template<>
-	GetStringFuncT<CharType<Encoding::UTF8>> String<Encoding::UTF8>::Get = WSGetUTF8String;
-	template<>
-	PutStringFuncT<CharType<Encoding::UTF8>> String<Encoding::UTF8>::Put = [](WSLINK m, const unsigned char* strData, int len) -> int {
-		if (EncodingConfig::useFastUTF8 && allASCIIQ(strData, len)) {
-			return WSPutByteString(m, strData, len);
-		} else {
-			return WSPutUTF8String(m, strData, len);
-		}
-	};
-	template<>
-	ReleaseStringFuncT<CharType<Encoding::UTF8>> String<Encoding::UTF8>::Release = WSReleaseUTF8String;
-	template<>
-	const std::string String<Encoding::UTF8>::GetFName = "WSGetUTF8String";
-	template<>
-	const std::string String<Encoding::UTF8>::PutFName = "WSPut(UTF8/Byte)String";
-
-	template<>
-	GetStringFuncT<CharType<Encoding::UTF16>> String<Encoding::UTF16>::Get = WSGetUTF16String;
-	template<>
-	PutStringFuncT<CharType<Encoding::UTF16>> String<Encoding::UTF16>::Put = WSPutUTF16String;
-	template<>
-	ReleaseStringFuncT<CharType<Encoding::UTF16>> String<Encoding::UTF16>::Release = WSReleaseUTF16String;
-	template<>
-	const std::string String<Encoding::UTF16>::GetFName = "WSGetUTF16String";
-	template<>
-	const std::string String<Encoding::UTF16>::PutFName = "WSPutUTF16String";
-
-	template<>
-	GetStringFuncT<CharType<Encoding::UCS2>> String<Encoding::UCS2>::Get = [](WSLINK m, const unsigned short** strData, int* len, int* charCnt) {
-		*charCnt = -1;
-		return WSGetUCS2String(m, strData, len);
-	};
-	template<>
-	PutStringFuncT<CharType<Encoding::UCS2>> String<Encoding::UCS2>::Put = WSPutUCS2String;
-	template<>
-	ReleaseStringFuncT<CharType<Encoding::UCS2>> String<Encoding::UCS2>::Release = WSReleaseUCS2String;
-	template<>
-	const std::string String<Encoding::UCS2>::GetFName = "WSGetUCS2String";
-	template<>
-	const std::string String<Encoding::UCS2>::PutFName = "WSPutUCS2String";
-
-	template<>
-	GetStringFuncT<CharType<Encoding::UTF32>> String<Encoding::UTF32>::Get = [](WSLINK m, const unsigned int** strData, int* len, int* charCnt) {
-		*charCnt = -1;
-		return WSGetUTF32String(m, strData, len);
-	};
-	template<>
-	PutStringFuncT<CharType<Encoding::UTF32>> String<Encoding::UTF32>::Put = WSPutUTF32String;
-	template<>
-	ReleaseStringFuncT<CharType<Encoding::UTF32>> String<Encoding::UTF32>::Release = WSReleaseUTF32String;
-	template<>
-	const std::string String<Encoding::UTF32>::GetFName = "WSGetUTF32String";
-	template<>
-	const std::string String<Encoding::UTF32>::PutFName = "WSPutUTF32String";
-
-#endif
-/// @endcond
 } /* namespace LLU::WS */
 
 #endif /* LLU_WSTP_STRINGS_H_ */
@@ -8,7 +8,10 @@
 #define LLU_WSTP_UTILITIES_H_
 
 #include <cstring>
+#include <functional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "wstp.h"
 
@@ -157,14 +160,33 @@ namespace LLU {
 		};
 
 		namespace Detail {
+			/**
+			 * @brief 		Throw an exception for a failed WSTP operation, with the error reported by WSTP attached to the debug info.
+			 * @param[in] 	m - low-level object of type WSLINK on which the operation failed
+			 * @param[in] 	errorName - what error name to put in the exception
+			 * @param[in] 	debugInfo - additional info to be attached to the exception
+			 */
+			[[noreturn]] void throwWSTPError(WSLINK m, const std::string& errorName, const std::string& debugInfo);
+
 			/**
 			 * @brief 		Checks if WSTP operation was successful and throws appropriate exception otherwise
+			 * @tparam		DebugInfo - a string type or a callable that returns a string
 			 * @param[in] 	m - low-level object of type WSLINK received from LibraryLink
 			 * @param[in] 	statusOk - status code return from a WSTP function
 			 * @param[in] 	errorName - what error name to put in the exception if WSTP function failed
-			 * @param[in] 	debugInfo - additional info to be attached to the exception
+			 * @param[in] 	debugInfo - additional info to be attached to the exception, callables are only invoked if the WSTP function failed,
+			 * 						so that successful calls do not pay for building the message
 			 */
-			void checkError(WSLINK m, int statusOk, const std::string& errorName, const std::string& debugInfo = "");
+			template<typename DebugInfo = const char*>
+			void checkError(WSLINK m, int statusOk, const std::string& errorName, DebugInfo&& debugInfo = "") {
+				if (statusOk == 0) [[unlikely]] {
+					if constexpr (std::is_invocable_v<DebugInfo>) {
+						throwWSTPError(m, errorName, std::invoke(std::forward<DebugInfo>(debugInfo)));
+					} else {
+						throwWSTPError(m, errorName, std::forward<DebugInfo>(debugInfo));
+					}
+				}
+			}
 
 			/**
 			 * @brief	Simple wrapper over ErrorManager::throwException used to break dependency cycle between WSStream and ErrorManager.
@@ -7,7 +7,9 @@
 #ifndef LLU_WSTP_UTILITYTYPETRAITS_HPP_
 #define LLU_WSTP_UTILITYTYPETRAITS_HPP_
 
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 #include "wstp.h"
 
@@ -63,6 +65,47 @@ namespace LLU::WS {
 	template<typename T>
 	inline constexpr bool StringTypeQ = supportedInWSStringQ<remove_cv_ref<T>>;
 
+	/// @cond
+	namespace Detail {
+		template<typename T, typename U>
+		constexpr bool holdsAllValuesQ() {
+			if constexpr (std::is_integral_v<T> && std::is_integral_v<U>) {
+				return std::cmp_less_equal(std::numeric_limits<U>::min(), std::numeric_limits<T>::min()) &&
+					   std::cmp_less_equal(std::numeric_limits<T>::max(), std::numeric_limits<U>::max());
+			} else {
+				return false;
+			}
+		}
+
+		template<typename T>
+		constexpr auto arrayElementType() {
+			if constexpr (ScalarSupportedTypeQ<T>) {
+				return std::type_identity<T> {};
+			} else if constexpr (holdsAllValuesQ<T, unsigned char>()) {
+				return std::type_identity<unsigned char> {};
+			} else if constexpr (holdsAllValuesQ<T, short>()) {
+				return std::type_identity<short> {};
+			} else if constexpr (holdsAllValuesQ<T, int>()) {
+				return std::type_identity<int> {};
+			} else if constexpr (holdsAllValuesQ<T, wsint64>()) {
+				return std::type_identity<wsint64> {};
+			} else {
+				return std::type_identity<void> {};
+			}
+		}
+	}  // namespace Detail
+	/// @endcond
+
+	/**
+	 * @brief	Type of elements of WSTP arrays used to send and receive containers of T, like NumericArray<T>.
+	 *
+	 * It is T itself if WSPut*Array supports T, otherwise the smallest integer type supported by WSTP that can hold all values of T,
+	 * or void if there is no such type (e.g. for std::uint64_t or std::complex<double>).
+	 * @tparam	T - any type
+	 */
+	template<typename T>
+	using ArrayElementType = typename decltype(Detail::arrayElementType<remove_cv_ref<T>>())::type;
+
 }  // namespace LLU::WS
 
 #endif /* LLU_WSTP_UTILITYTYPETRAITS_HPP_ */
@@ -8,8 +8,12 @@
 #define LLU_WSTP_WSSTREAM_HPP_
 
 #include <algorithm>
+#include <climits>
+#include <functional>
 #include <iterator>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <stack>
 #include <type_traits>
 #include <utility>
@@ -28,6 +32,18 @@
 
 namespace LLU {
 
+	template<typename T>
+	class MArray;
+
+	template<typename T>
+	class Tensor;
+
+	template<typename T>
+	class NumericArray;
+
+	template<typename T>
+	class Image;
+
 	/**
 	 * @class 	WSStream
 	 * @brief 	Wrapper class over WSTP with a stream-like interface.
@@ -66,14 +82,19 @@ namespace LLU {
 		WSStream(WSLINK mlp, const std::string& head, int argc);
 
 		/**
-		 *   @brief Default destructor
+		 *   @brief Default destructor, helper loopback links are closed when the last copy of the stream is destroyed
 		 **/
 		~WSStream() = default;
 
 		/**
 		 *   @brief Returns a reference to underlying low-level WSTP handle
+		 *   @note  Expressions sent directly to the handle between BeginExpr and EndExpr are not counted by WSStream, so EndExpr has to count
+		 *          the arguments of the current expression by transferring them through another loopback link, which is slower.
 		 **/
 		WSLINK& get() noexcept {
+			if (loopbackStack.size() > 1) {
+				loopbackStack.top().countingDisabled = true;
+			}
 			return m;
 		}
 
@@ -106,7 +127,22 @@ namespace LLU {
 		using BidirStreamToken = WSStream& (*)(WSStream&, WS::Direction);
 
 		/// Type of data stored on the stack to facilitate sending expressions of a priori unknown length
-		using LoopbackData = std::pair<std::string, WSLINK>;
+		struct LoopbackData {
+			/// Head of the expression
+			std::string head;
+
+			/// Loopback link that stores the arguments of the expression
+			WSLINK link {};
+
+			/// Number of complete arguments of the expression sent so far
+			int argCount = 0;
+
+			/// Number of arguments still missing in the last argument sent, e.g. 2 right after WS::Rule
+			int pendingArgs = 0;
+
+			/// Whether the link has been accessed directly so argCount may be incorrect
+			bool countingDisabled = false;
+		};
 
 		//
 		//	operator<<
@@ -307,6 +343,36 @@ namespace LLU {
 		template<typename K, typename V>
 		WSStream& operator<<(const std::map<K, V>& map);
 
+		/**
+		 *   @brief			Sends a Tensor as nested Lists with a single call to WSPut*Array
+		 *   @tparam		T - Tensor element type, complex Tensors are not supported
+		 *   @param[in] 	t - Tensor to be sent
+		 *
+		 *   @throws 		ErrorName::WSPutArrayError
+		 **/
+		template<typename T>
+		WSStream& operator<<(const Tensor<T>& t);
+
+		/**
+		 *   @brief			Sends a NumericArray as nested Lists with a single call to WSPut*Array
+		 *   @tparam		T - NumericArray element type, elements not supported by WSTP are converted to a larger integer type if possible
+		 *   @param[in] 	na - NumericArray to be sent
+		 *
+		 *   @throws 		ErrorName::WSPutArrayError
+		 **/
+		template<typename T>
+		WSStream& operator<<(const NumericArray<T>& na);
+
+		/**
+		 *   @brief			Sends pixel values of an Image as nested Lists with a single call to WSPut*Array
+		 *   @tparam		T - Image element type
+		 *   @param[in] 	im - Image to be sent, the dimensions of the nested Lists are the same as Image dimensions
+		 *
+		 *   @throws 		ErrorName::WSPutArrayError
+		 **/
+		template<typename T>
+		WSStream& operator<<(const Image<T>& im);
+
 		/**
 		 *   @brief			Sends a scalar value (int, float, double, etc) if it is supported by WSTP
 		 *   If you need to send value of type not supported by WSTP (like unsigned int) you must either explicitly cast
@@ -486,6 +552,27 @@ namespace LLU {
 		template<typename K, typename V>
 		WSStream& operator>>(std::map<K, V>& map);
 
+		/**
+		 *   @brief			Receives a full array (nested Lists of equal lengths) from WSTP into a new Tensor
+		 *   @tparam		T - Tensor element type, complex Tensors are not supported
+		 *   @param[out] 	t - argument to which the Tensor created from the array received from WSTP will be assigned
+		 *
+		 *   @throws 		ErrorName::WSGetArrayError
+		 **/
+		template<typename T>
+		WSStream& operator>>(Tensor<T>& t);
+
+		/**
+		 *   @brief			Receives a full array (nested Lists of equal lengths) from WSTP into a new NumericArray
+		 *   @tparam		T - NumericArray element type, elements not supported by WSTP are read as a larger integer type if possible
+		 *   @param[out] 	na - argument to which the NumericArray created from the array received from WSTP will be assigned
+		 *
+		 *   @throws 		ErrorName::WSGetArrayError
+		 *   @note			Values that do not fit in \c T are converted with static_cast
+		 **/
+		template<typename T>
+		WSStream& operator>>(NumericArray<T>& na);
+
 		/**
 		 *   @brief			Receives a scalar value (int, float, double, etc) if it is supported by WSTP
 		 *   If you need to receive value of type not supported by WSTP (like unsigned int) you must either explicitly cast
@@ -503,11 +590,13 @@ namespace LLU {
 		 *   @brief			Check if the call to WSTP API succeeded, throw an exception otherwise
 		 *   @param[in] 	statusOk - error code returned from WSTP API function, usually 0 means error
 		 *   @param[in]		errorName - which exception to throw
-		 *   @param[in]		debugInfo - additional information to include in the exception, should it be thrown
+		 *   @param[in]		debugInfo - additional information to include in the exception, should it be thrown, either a string
+		 *   				or a callable that returns the string and is only invoked if the call failed
 		 *
 		 *   @throws 		errorName
 		 **/
-		void check(int statusOk, const std::string& errorName, const std::string& debugInfo = "");
+		template<typename DebugInfo = const char*>
+		void check(int statusOk, const std::string& errorName, DebugInfo&& debugInfo = "");
 
 		/**
 		 * 	 @brief			Test if the next expression to be read from WSTP has given head
@@ -532,7 +621,86 @@ namespace LLU {
 		 */
 		void refreshCurrentWSLINK();
 
+		/**
+		 *	@brief		Record that an expression has been sent, so that EndExpr knows how many arguments the current expression has.
+		 *	@param[in]	argc - number of arguments of the expression that will be sent next, e.g. 2 for WS::Rule
+		 */
+		void registerExpression(int argc = 0) noexcept;
+
+		/**
+		 *	@brief		Send the data of a Tensor, NumericArray or Image with a single call to WSPut*Array
+		 *	@tparam		T - container element type
+		 *	@param[in]	a - container to be sent
+		 *	@throws		ErrorName::WSPutArrayError
+		 */
+		template<typename T>
+		void putMArray(const MArray<T>& a);
+
+		/**
+		 *	@brief		Receive a full array with a single call to WSGet*Array and copy it directly to a new container
+		 *	@tparam		Container - Tensor or NumericArray
+		 *	@tparam		T - container element type
+		 *	@throws		ErrorName::WSGetArrayError
+		 */
+		template<template<typename> class Container, typename T>
+		Container<T> getMArray();
+
 	private:
+		/// Helper loopback links opened by a stream, shared with copies of the stream and closed when the last of them is destroyed
+		class LoopbackLinks {
+		public:
+			LoopbackLinks() = default;
+			LoopbackLinks(const LoopbackLinks&) = delete;
+			LoopbackLinks& operator=(const LoopbackLinks&) = delete;
+			LoopbackLinks(LoopbackLinks&&) = delete;
+			LoopbackLinks& operator=(LoopbackLinks&&) = delete;
+
+			/// Close the links of expressions that were never ended and the links kept for reuse
+			~LoopbackLinks() {
+				for (auto* link : open) {
+					WSClose(link);
+				}
+				for (auto* link : pool) {
+					WSClose(link);
+				}
+			}
+
+			/// Get an empty loopback link for a new expression, reusing a link left by one of the previous expressions if possible
+			WSLINK acquire(WSLINK parent) {
+				open.reserve(open.size() + 1);
+				WSLINK link {};
+				if (pool.empty()) {
+					link = WS::Detail::getNewLoopback(parent);
+				} else {
+					link = pool.back();
+					pool.pop_back();
+				}
+				open.push_back(link);
+				return link;
+			}
+
+			/// Keep the link of an ended expression, which is empty now, for reuse
+			void release(WSLINK link) {
+				pool.push_back(link);
+				std::erase(open, link);
+			}
+
+			/// Track \p link instead of \p closed, whose contents have been moved to \p link
+			void replace(WSLINK closed, WSLINK link) noexcept {
+				std::replace(open.begin(), open.end(), closed, link);
+			}
+
+			/// Close the link of a dropped expression
+			void close(WSLINK link) noexcept {
+				WSClose(link);
+				std::erase(open, link);
+			}
+
+		private:
+			std::vector<WSLINK> open;
+			std::vector<WSLINK> pool;
+		};
+
 		/// Internal low-level handle to the currently active WSTP, it is assumed that the handle is valid.
 		WSLINK m {};
 
@@ -541,6 +709,9 @@ namespace LLU {
 		/// The data structure called stack seems to be the most reasonable choice.
 		std::stack<LoopbackData> loopbackStack;
 
+		/// Loopback links of expressions on the stack and links left empty by EndExpr, which are reused by subsequent BeginExpr instead of opening new links.
+		std::shared_ptr<LoopbackLinks> loopbacks;
+
 		/// Boolean flag to indicate if the current expression initiated with BeginExpr has been dropped. It is needed for EndExpr to behave correctly.
 		bool currentExprDropped = false;
 	};
@@ -548,7 +719,8 @@ namespace LLU {
 /// @cond
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
-	WSStream<EIn, EOut>::WSStream(WSLINK mlp) : m(mlp), loopbackStack(std::deque<LoopbackData> {{"", mlp}}) {
+	WSStream<EIn, EOut>::WSStream(WSLINK mlp)
+		: m(mlp), loopbackStack(std::deque<LoopbackData> {{.head = "", .link = mlp}}), loopbacks(std::make_shared<LoopbackLinks>()) {
 		if (!mlp) {
 			WS::Detail::throwLLUException(ErrorName::WSNullWSLinkError);
 		}
@@ -576,14 +748,15 @@ namespace LLU {
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
-	void WSStream<EIn, EOut>::check(int statusOk, const std::string& errorName, const std::string& debugInfo) {
-		WS::Detail::checkError(m, statusOk, errorName, debugInfo);
+	template<typename DebugInfo>
+	void WSStream<EIn, EOut>::check(int statusOk, const std::string& errorName, DebugInfo&& debugInfo) {
+		WS::Detail::checkError(m, statusOk, errorName, std::forward<DebugInfo>(debugInfo));
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	int WSStream<EIn, EOut>::testHead(const std::string& head) {
 		int argcount {};
-		check(WSTestHead(m, head.c_str(), &argcount), ErrorName::WSTestHeadError, "Expected \"" + head + "\"");
+		check(WSTestHead(m, head.c_str(), &argcount), ErrorName::WSTestHeadError, [&head] { return "Expected \"" + head + "\""; });
 		return argcount;
 	}
 
@@ -600,7 +773,55 @@ namespace LLU {
 		if (loopbackStack.empty()) {
 			WS::Detail::throwLLUException(ErrorName::WSLoopbackStackSizeError, "Stack is empty in refreshCurrentWSLINK()");
 		}
-		m = std::get<WSLINK>(loopbackStack.top());
+		m = loopbackStack.top().link;
+	}
+
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	void WSStream<EIn, EOut>::registerExpression(int argc) noexcept {
+		if (loopbackStack.size() < 2) {
+			return;
+		}
+		auto& currentExpr = loopbackStack.top();
+		if (currentExpr.pendingArgs > 0) {
+			--currentExpr.pendingArgs;
+		} else {
+			++currentExpr.argCount;
+		}
+		currentExpr.pendingArgs += argc;
+	}
+
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<typename T>
+	void WSStream<EIn, EOut>::putMArray(const MArray<T>& a) {
+		using ElemT = WS::ArrayElementType<T>;
+		static_assert(!std::is_void_v<ElemT>, "Element type of the container cannot be sent via WSTP as an array.");
+
+		const auto& dims = a.dimensions().get();
+		if (std::any_of(dims.cbegin(), dims.cend(), [](mint d) { return d > INT_MAX; })) {
+			WS::Detail::throwLLUException(ErrorName::WSPutArrayError, "Array dimensions do not fit in int");
+		}
+		std::vector<int> wsDims {dims.cbegin(), dims.cend()};
+		if constexpr (std::is_same_v<ElemT, T>) {
+			WS::PutArray<T>::put(m, a.data(), wsDims.data(), static_cast<const char**>(nullptr), static_cast<int>(a.rank()));
+		} else {
+			std::vector<ElemT> converted {a.begin(), a.end()};
+			WS::PutArray<ElemT>::put(m, converted.data(), wsDims.data(), static_cast<const char**>(nullptr), static_cast<int>(a.rank()));
+		}
+		registerExpression();
+	}
+
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<template<typename> class Container, typename T>
+	Container<T> WSStream<EIn, EOut>::getMArray() {
+		using ElemT = WS::ArrayElementType<T>;
+		static_assert(!std::is_void_v<ElemT>, "Element type of the container cannot be received via WSTP as an array.");
+
+		auto array = WS::GetArray<ElemT>::get(m);
+		const auto& del = array.get_deleter();
+		auto* dims = del.getDims();
+		auto* first = array.get();
+		auto* last = std::next(first, std::accumulate(dims, std::next(dims, del.getRank()), mint {1}, std::multiplies<> {}));
+		return Container<T> {first, last, {dims, del.getRank()}};
 	}
 
 	//
@@ -619,21 +840,24 @@ namespace LLU {
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator<<(const WS::Symbol& s) -> WSStream& {
-		check(WSPutSymbol(m, s.getHead().c_str()), ErrorName::WSPutSymbolError, "Cannot put symbol: \"" + s.getHead() + "\"");
+		check(WSPutSymbol(m, s.getHead().c_str()), ErrorName::WSPutSymbolError, [&s] { return "Cannot put symbol: \"" + s.getHead() + "\""; });
+		registerExpression();
 		return *this;
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator<<(const WS::Function& f) -> WSStream& {
 		check(WSPutFunction(m, f.getHead().c_str(), f.getArgc()), ErrorName::WSPutFunctionError,
-			  "Cannot put function: \"" + f.getHead() + "\" with " + std::to_string(f.getArgc()) + " arguments");
+			  [&f] { return "Cannot put function: \"" + f.getHead() + "\" with " + std::to_string(f.getArgc()) + " arguments"; });
+		registerExpression(f.getArgc());
 		return *this;
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator<<(const WS::Missing& f) -> WSStream& {
 		check(WSPutFunction(m, f.getHead().c_str(), 1),	   // f.getArgc() could be 0 but we still want to send f.reason, even if it's an empty string
-			  ErrorName::WSPutFunctionError, "Cannot put function: \"" + f.getHead() + "\" with 1 argument");
+			  ErrorName::WSPutFunctionError, [&f] { return "Cannot put function: \"" + f.getHead() + "\" with 1 argument"; });
+		registerExpression(1);
 		*this << f.why();
 		return *this;
 	}
@@ -644,11 +868,11 @@ namespace LLU {
 		// reset dropped expression flag
 		currentExprDropped = false;
 
-		// create a new LoopbackLink for the expression
-		auto* loopback = WS::Detail::getNewLoopback(m);
+		// reuse a LoopbackLink left by one of the previous expressions or create a new one
+		auto* loopback = loopbacks->acquire(m);
 
 		// store expression head together with the link on the stack
-		loopbackStack.emplace(expr.getHead(), loopback);
+		loopbackStack.push({.head = expr.getHead(), .link = loopback});
 
 		// active WSLINK changes
 		refreshCurrentWSLINK();
@@ -664,7 +888,7 @@ namespace LLU {
 								  "Trying to Drop expression with loopback stack size " + std::to_string(loopbackStack.size()));
 		}
 		// we are dropping the expression so just close the link and hope that WSTP will do the cleanup
-		WSClose(std::get<WSLINK>(loopbackStack.top()));
+		loopbacks->close(loopbackStack.top().link);
 		loopbackStack.pop();
 		refreshCurrentWSLINK();
 
@@ -690,20 +914,30 @@ namespace LLU {
 		}
 
 		// extract active loopback link and expression head
-		auto currentPartialExpr = loopbackStack.top();
+		auto currentPartialExpr = std::move(loopbackStack.top());
 		loopbackStack.pop();
 
 		// active WSLINK changes
 		refreshCurrentWSLINK();
 
-		// now count the expressions accumulated in the loopback link and send them to the parent link after the head
-		auto& exprArgs = std::get<WSLINK>(currentPartialExpr);
-		auto argCnt = WS::Detail::countExpressionsInLoopbackLink(exprArgs);
-		*this << WS::Function(std::get<std::string>(currentPartialExpr), argCnt);
+		// arguments have been counted as they were sent, unless someone wrote to the loopback link directly, in which case we must count them now
+		auto& exprArgs = currentPartialExpr.link;
+		auto argCnt = currentPartialExpr.argCount;
+		if (currentPartialExpr.countingDisabled) {
+			auto* counted = exprArgs;
+			argCnt = WS::Detail::countExpressionsInLoopbackLink(exprArgs);
+			loopbacks->replace(counted, exprArgs);
+		}
+
+		// send the head and then all the arguments to the parent link, the whole expression counts as a single argument of the parent expression
+		check(WSPutFunction(m, currentPartialExpr.head.c_str(), argCnt), ErrorName::WSPutFunctionError,
+			  [&currentPartialExpr, argCnt] { return "Cannot put function: \"" + currentPartialExpr.head + "\" with " + std::to_string(argCnt) + " arguments"; });
 		check(WSTransferToEndOfLoopbackLink(m, exprArgs), ErrorName::WSTransferToLoopbackError,
-			  "Could not transfer " + std::to_string(argCnt) + " expressions from Loopback Link");
-		// finally, close the loopback link
-		WSClose(exprArgs);
+			  [argCnt] { return "Could not transfer " + std::to_string(argCnt) + " expressions from Loopback Link"; });
+		registerExpression();
+
+		// finally, the loopback link is empty and can be reused
+		loopbacks->release(exprArgs);
 
 		return *this;
 	}
@@ -716,6 +950,7 @@ namespace LLU {
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator<<(mint i) -> WSStream& {
 		WS::PutScalar<wsint64>::put(m, static_cast<wsint64>(i));
+		registerExpression();
 		return *this;
 	}
 
@@ -724,6 +959,7 @@ namespace LLU {
 	auto WSStream<EIn, EOut>::operator<<(const WS::ArrayData<T>& a) -> WSStream& {
 		const auto& del = a.get_deleter();
 		WS::PutArray<T>::put(m, a.get(), del.getDims(), del.getHeads(), del.getRank());
+		registerExpression();
 		return *this;
 	}
 
@@ -732,6 +968,7 @@ namespace LLU {
 	auto WSStream<EIn, EOut>::operator<<(const WS::ListData<T>& l) -> WSStream& {
 		const auto& del = l.get_deleter();
 		WS::PutList<T>::put(m, l.get(), del.getLength());
+		registerExpression();
 		return *this;
 	}
 
@@ -751,6 +988,7 @@ namespace LLU {
 	auto WSStream<EIn, EOut>::operator<<(const std::vector<T>& l) -> WSStream& {
 		if constexpr (WS::ScalarSupportedTypeQ<T>) {
 			WS::PutList<T>::put(m, l.data(), static_cast<int>(l.size()));
+			registerExpression();
 		} else {
 			*this << WS::List(static_cast<int>(l.size()));
 			for (const auto& elem : l) {
@@ -764,6 +1002,7 @@ namespace LLU {
 	template<WS::Encoding E>
 	auto WSStream<EIn, EOut>::operator<<(const WS::StringData<E>& s) -> WSStream& {
 		WS::String<E>::put(m, s.get(), s.get_deleter().getLength());
+		registerExpression();
 		return *this;
 	}
 
@@ -772,6 +1011,7 @@ namespace LLU {
 	auto WSStream<EIn, EOut>::operator<<(const std::basic_string<T>& s) -> WSStream& {
 		if constexpr (WS::StringTypeQ<T>) {
 			WS::String<EOut>::put(m, s.c_str(), static_cast<int>(s.size()));
+			registerExpression();
 		} else {
 			static_assert(dependent_false_v<T>, "Calling operator<< with unsupported character type.");
 		}
@@ -782,6 +1022,7 @@ namespace LLU {
 	template<typename T, std::size_t N, typename>
 	auto WSStream<EIn, EOut>::operator<<(const T (&s)[N]) -> WSStream& {
 		WS::String<EOut>::put(m, s, N);
+		registerExpression();
 		return *this;
 	}
 
@@ -790,18 +1031,21 @@ namespace LLU {
 	auto WSStream<EIn, EOut>::operator<<(const WS::PutAs<E, T>& wrp) -> WSStream& {
 		WSStream<EIn, E> tmpWSS {m};
 		tmpWSS << wrp.obj;
+		registerExpression();
 		return *this;
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator<<(const char* s) -> WSStream& {
 		WS::String<EOut>::put(m, s, static_cast<int>(std::strlen(s)));
+		registerExpression();
 		return *this;
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator<<(std::string_view s) -> WSStream& {
 		WS::String<EOut>::put(m, s.data(), static_cast<int>(s.length()));
+		registerExpression();
 		return *this;
 	}
 
@@ -810,6 +1054,7 @@ namespace LLU {
 	auto WSStream<EIn, EOut>::operator<<(T value) -> WSStream& {
 		if constexpr (WS::ScalarSupportedTypeQ<T>) {
 			WS::PutScalar<T>::put(m, value);
+			registerExpression();
 		} else {
 			static_assert(dependent_false_v<T>, "Calling operator<< with unsupported scalar type.");
 		}
@@ -826,6 +1071,27 @@ namespace LLU {
 		return *this;
 	}
 
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<typename T>
+	auto WSStream<EIn, EOut>::operator<<(const Tensor<T>& t) -> WSStream& {
+		putMArray<T>(t);
+		return *this;
+	}
+
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<typename T>
+	auto WSStream<EIn, EOut>::operator<<(const NumericArray<T>& na) -> WSStream& {
+		putMArray<T>(na);
+		return *this;
+	}
+
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<typename T>
+	auto WSStream<EIn, EOut>::operator<<(const Image<T>& im) -> WSStream& {
+		putMArray<T>(im);
+		return *this;
+	}
+
 	//
 	//	Definitions of WSStream<EIn, EOut>::operator>>
 	//
@@ -837,14 +1103,14 @@ namespace LLU {
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator>>(const WS::Symbol& s) -> WSStream& {
-		check(WSTestSymbol(m, s.getHead().c_str()), ErrorName::WSTestSymbolError, "Cannot get symbol: \"" + s.getHead() + "\"");
+		check(WSTestSymbol(m, s.getHead().c_str()), ErrorName::WSTestSymbolError, [&s] { return "Cannot get symbol: \"" + s.getHead() + "\""; });
 		return *this;
 	}
 
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	auto WSStream<EIn, EOut>::operator>>(WS::Symbol& s) -> WSStream& {
 		if (!s.getHead().empty()) {
-			check(WSTestSymbol(m, s.getHead().c_str()), ErrorName::WSTestSymbolError, "Cannot get symbol: \"" + s.getHead() + "\"");
+			check(WSTestSymbol(m, s.getHead().c_str()), ErrorName::WSTestSymbolError, [&s] { return "Cannot get symbol: \"" + s.getHead() + "\""; });
 		} else {
 			const char* head {};
 			check(WSGetSymbol(m, &head), ErrorName::WSGetSymbolError, "Cannot get symbol");
@@ -974,6 +1240,20 @@ namespace LLU {
 		return *this;
 	}
 
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<typename T>
+	auto WSStream<EIn, EOut>::operator>>(Tensor<T>& t) -> WSStream& {
+		t = getMArray<Tensor, T>();
+		return *this;
+	}
+
+	template<WS::Encoding EIn, WS::Encoding EOut>
+	template<typename T>
+	auto WSStream<EIn, EOut>::operator>>(NumericArray<T>& na) -> WSStream& {
+		na = getMArray<NumericArray, T>();
+		return *this;
+	}
+
 	template<WS::Encoding EIn, WS::Encoding EOut>
 	template<typename T, typename>
 	auto WSStream<EIn, EOut>::operator>>(T& value) -> WSStream& {
@@ -0,0 +1,524 @@
+/**
+ * @file	AsyncFile.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of AsyncFile with io_uring and thread pool backends.
+ */
+
+#include "LLU/NoMinMaxWindows.h"
+#include "LLU/AsyncFile.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#define LLU_ASYNCFILE_IO_URING
+#endif
+
+#include "LLU/Async/ThreadPool.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/FileUtilities.h"
+
+namespace LLU {
+
+	struct AsyncFile::Request {
+		/// Buffer to read into or write from
+		std::byte* data;
+
+		/// Number of bytes to transfer
+		std::size_t length;
+
+		/// Position in the file
+		std::uint64_t offset;
+
+		/// Whether this is a write request
+		bool write;
+
+		/// Callback to call when the request finishes
+		Completion onDone;
+
+		/// Number of bytes transferred so far
+		std::size_t transferred = 0;
+
+		/// System error code of a failed request, 0 on success
+		int error = 0;
+	};
+
+	class AsyncFile::Engine {
+	public:
+#ifdef _WIN32
+		using Handle = HANDLE;
+#else
+		using Handle = int;
+#endif
+
+		explicit Engine(Handle file) : file {file} {}
+
+		Engine(const Engine&) = delete;
+		Engine& operator=(const Engine&) = delete;
+		Engine(Engine&&) = delete;
+		Engine& operator=(Engine&&) = delete;
+
+		/// Close the file, derived classes must not have any requests in flight at this point
+		virtual ~Engine() {
+#ifdef _WIN32
+			CloseHandle(file);
+#else
+			::close(file);
+#endif
+		}
+
+		/// Start transferring the remaining bytes of a request
+		virtual void start(Request* request) = 0;
+
+		/// Send started requests to the system
+		virtual void flush() = 0;
+
+		/// Move finished requests to \p finished, if \p block is true wait until at least one request finishes. Requests moved before an exception
+		/// is thrown stay in \p finished.
+		virtual void reap(bool block, std::vector<std::unique_ptr<Request>>& finished) = 0;
+
+	protected:
+		Handle file;
+	};
+
+	namespace {
+		/// Maximal number of bytes transferred by a single system call, longer requests are split
+		constexpr std::size_t MaxTransfer = std::size_t {1} << 30U;
+
+		/// Error code of a write that transferred no bytes
+#ifdef _WIN32
+		constexpr int ShortWrite = ERROR_WRITE_FAULT;
+#else
+		constexpr int ShortWrite = EIO;
+#endif
+
+		AsyncFile::Engine::Handle openHandle(const std::string& fileName, std::ios::openmode mode) {
+			const bool read = (mode & std::ios::in) != 0;
+			const bool write = (mode & (std::ios::out | std::ios::app)) != 0;
+			if (!read && !write) {
+				ErrorManager::throwException(ErrorName::InvalidOpenMode);
+			}
+			validatePath(fileName, mode);
+#ifdef _WIN32
+			const DWORD access = (read ? GENERIC_READ : 0) | (write ? GENERIC_WRITE : 0);
+			const DWORD disposition = (mode & std::ios::trunc) != 0 ? CREATE_ALWAYS : (write ? OPEN_ALWAYS : OPEN_EXISTING);
+			// same sharing as AlwaysReadExclusiveWrite
+			const DWORD share = write ? FILE_SHARE_READ : (FILE_SHARE_READ | FILE_SHARE_WRITE);
+			std::wstring fileNameUTF16 = fromUTF8toUTF16<wchar_t>(fileName);
+			HANDLE file = CreateFileW(fileNameUTF16.c_str(), access, share, nullptr, disposition, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE) {
+				ErrorManager::throwException(ErrorName::OpenFileFailed, fileName);
+			}
+#else
+			// O_APPEND is never used, because it makes positioned writes ignore the offset on Linux
+			int flags = (read && write) ? O_RDWR : (write ? O_WRONLY : O_RDONLY);
+			flags |= (write ? O_CREAT : 0) | ((mode & std::ios::trunc) != 0 ? O_TRUNC : 0) | O_CLOEXEC;
+			const int file = ::open(fileName.c_str(), flags, 0666);	   // NOLINT(cppcoreguidelines-pro-type-vararg)
+			if (file < 0) {
+				ErrorManager::throwException(ErrorName::OpenFileFailed, fileName);
+			}
+#endif
+			return file;
+		}
+
+		/// Perform a blocking positioned transfer of the remaining bytes of a request
+		void transfer(AsyncFile::Engine::Handle file, AsyncFile::Request& r) noexcept {
+			while (r.transferred < r.length) {
+				auto* buffer = r.data + r.transferred;
+				const auto count = std::min(r.length - r.transferred, MaxTransfer);
+				const auto offset = r.offset + r.transferred;
+#ifdef _WIN32
+				OVERLAPPED position {};
+				position.Offset = static_cast<DWORD>(offset & 0xFFFFFFFFU);
+				position.OffsetHigh = static_cast<DWORD>(offset >> 32U);
+				DWORD done = 0;
+				const auto success = r.write ? WriteFile(file, buffer, static_cast<DWORD>(count), &done, &position)
+											 : ReadFile(file, buffer, static_cast<DWORD>(count), &done, &position);
+				if (!success) {
+					if (const auto e = GetLastError(); e != ERROR_HANDLE_EOF) {
+						r.error = static_cast<int>(e);
+					}
+					return;
+				}
+#else
+				const auto position = static_cast<off_t>(offset);
+				const auto done = r.write ? ::pwrite(file, buffer, count, position) : ::pread(file, buffer, count, position);
+				if (done < 0) {
+					if (errno == EINTR) {
+						continue;
+					}
+					r.error = errno;
+					return;
+				}
+#endif
+				if (done == 0) {
+					// end of file for reads, writes of zero bytes are unexpected
+					if (r.write) {
+						r.error = ShortWrite;
+					}
+					return;
+				}
+				r.transferred += static_cast<std::size_t>(done);
+			}
+		}
+
+		/// Performs blocking I/O on a pool of background threads
+		class ThreadPoolEngine final : public AsyncFile::Engine {
+		public:
+			ThreadPoolEngine(Handle file, unsigned depth) : Engine(file), pool {std::min(std::clamp(std::thread::hardware_concurrency(), 2U, 8U), depth)} {}
+
+			void start(AsyncFile::Request* request) override {
+				pool.submit([this, request] {
+					transfer(file, *request);
+					{
+						std::scoped_lock lock {mutex};
+						done.push_back(request);
+					}
+					requestDone.notify_one();
+				});
+			}
+
+			void flush() override {}
+
+			void reap(bool block, std::vector<std::unique_ptr<AsyncFile::Request>>& finished) override {
+				std::unique_lock lock {mutex};
+				if (block) {
+					requestDone.wait(lock, [this] { return !done.empty(); });
+				}
+				finished.reserve(finished.size() + done.size());
+				for (auto* request : done) {
+					finished.emplace_back(request);
+				}
+				done.clear();
+			}
+
+		private:
+			std::mutex mutex;
+			std::condition_variable requestDone;
+
+			/// Requests finished and not yet reaped
+			std::vector<AsyncFile::Request*> done;
+
+			/// Worker threads, declared last so that they are joined before other members are destroyed and before the file is closed
+			BasicPool pool;
+		};
+
+#ifdef LLU_ASYNCFILE_IO_URING
+		/// An io_uring instance with its submission and completion queues mapped into memory
+		struct Ring {
+			Ring() = default;
+			Ring(const Ring&) = delete;
+			Ring& operator=(const Ring&) = delete;
+			Ring(Ring&&) = delete;
+			Ring& operator=(Ring&&) = delete;
+
+			~Ring() {
+				if (sqes != MAP_FAILED) {
+					::munmap(sqes, sqesSize);
+				}
+				if (cq != MAP_FAILED && cq != sq) {
+					::munmap(cq, cqSize);
+				}
+				if (sq != MAP_FAILED) {
+					::munmap(sq, sqSize);
+				}
+				if (fd >= 0) {
+					::close(fd);
+				}
+			}
+
+			int fd = -1;
+			io_uring_params params {};
+			void* sq = MAP_FAILED;
+			std::size_t sqSize = 0;
+			void* cq = MAP_FAILED;
+			std::size_t cqSize = 0;
+			void* sqes = MAP_FAILED;
+			std::size_t sqesSize = 0;
+		};
+
+		/// Set up an io_uring instance, return nullptr if io_uring is not supported
+		std::unique_ptr<Ring> setupRing(unsigned entries) {
+			auto ring = std::make_unique<Ring>();
+			ring->fd = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &ring->params));
+			// IORING_OP_READ and IORING_OP_WRITE were introduced together with this feature
+			if (ring->fd < 0 || (ring->params.features & IORING_FEAT_RW_CUR_POS) == 0) {
+				return nullptr;
+			}
+			const auto& p = ring->params;
+			ring->sqSize = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+			ring->cqSize = p.cq_off.cqes + p.cq_entries * sizeof(io_uring_cqe);
+			const bool singleMapping = (p.features & IORING_FEAT_SINGLE_MMAP) != 0;
+			if (singleMapping) {
+				ring->sqSize = ring->cqSize = std::max(ring->sqSize, ring->cqSize);
+			}
+			constexpr int protection = PROT_READ | PROT_WRITE;
+			constexpr int flags = MAP_SHARED | MAP_POPULATE;
+			ring->sq = ::mmap(nullptr, ring->sqSize, protection, flags, ring->fd, IORING_OFF_SQ_RING);
+			if (ring->sq == MAP_FAILED) {
+				return nullptr;
+			}
+			ring->cq = singleMapping ? ring->sq : ::mmap(nullptr, ring->cqSize, protection, flags, ring->fd, IORING_OFF_CQ_RING);
+			if (ring->cq == MAP_FAILED) {
+				return nullptr;
+			}
+			ring->sqesSize = p.sq_entries * sizeof(io_uring_sqe);
+			ring->sqes = ::mmap(nullptr, ring->sqesSize, protection, flags, ring->fd, IORING_OFF_SQES);
+			if (ring->sqes == MAP_FAILED) {
+				return nullptr;
+			}
+			return ring;
+		}
+
+		/// Performs I/O with io_uring, all calls are made on the thread which owns the AsyncFile
+		class IoUringEngine final : public AsyncFile::Engine {
+		public:
+			IoUringEngine(Handle file, std::unique_ptr<Ring> r, const std::string& fileName) : Engine(file), ring {std::move(r)}, fileName {fileName} {
+				const auto& p = ring->params;
+				auto* sq = static_cast<std::byte*>(ring->sq);
+				auto* cq = static_cast<std::byte*>(ring->cq);
+				// NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast): the layout of the rings is described by offsets returned by the kernel
+				sqTail = reinterpret_cast<unsigned*>(sq + p.sq_off.tail);
+				sqMask = *reinterpret_cast<unsigned*>(sq + p.sq_off.ring_mask);
+				sqArray = reinterpret_cast<unsigned*>(sq + p.sq_off.array);
+				sqes = static_cast<io_uring_sqe*>(ring->sqes);
+				cqHead = reinterpret_cast<unsigned*>(cq + p.cq_off.head);
+				cqTail = reinterpret_cast<unsigned*>(cq + p.cq_off.tail);
+				cqMask = *reinterpret_cast<unsigned*>(cq + p.cq_off.ring_mask);
+				cqes = reinterpret_cast<io_uring_cqe*>(cq + p.cq_off.cqes);
+				// NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+			}
+
+			void start(AsyncFile::Request* request) override {
+				if (request->write) {
+					++writesInFlight;
+				}
+				prepare(request);
+			}
+
+			void flush() override {
+				enter(0);
+			}
+
+			void reap(bool block, std::vector<std::unique_ptr<AsyncFile::Request>>& finished) override {
+				collect(finished);
+				while (block && finished.empty()) {
+					enter(1);
+					collect(finished);
+				}
+				// submit continuations of short transfers
+				enter(0);
+			}
+
+		private:
+			/// Add an entry transferring the remaining bytes of a request to the submission queue
+			void prepare(AsyncFile::Request* request) {
+				// each request has at most one entry in the queue and the number of requests in flight does not exceed the queue size
+				const auto tail = *sqTail;
+				const auto index = tail & sqMask;
+				auto& sqe = sqes[index];
+				sqe = {};
+				sqe.opcode = request->write ? IORING_OP_WRITE : IORING_OP_READ;
+				sqe.fd = file;
+				sqe.off = request->offset + request->transferred;
+				sqe.addr = reinterpret_cast<std::uintptr_t>(request->data + request->transferred);	  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				sqe.len = static_cast<std::uint32_t>(std::min(request->length - request->transferred, MaxTransfer));
+				sqe.user_data = reinterpret_cast<std::uintptr_t>(request);	  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+				sqArray[index] = index;
+				std::atomic_ref {*sqTail}.store(tail + 1, std::memory_order_release);
+				++unsubmitted;
+			}
+
+			/// Submit prepared entries and wait for at least \p minComplete completions
+			void enter(unsigned minComplete) {
+				if (unsubmitted == 0 && minComplete == 0) {
+					return;
+				}
+				const unsigned flags = minComplete > 0 ? IORING_ENTER_GETEVENTS : 0U;
+				while (true) {
+					const auto submitted = ::syscall(__NR_io_uring_enter, ring->fd, unsubmitted, minComplete, flags, nullptr, 0);
+					if (submitted >= 0) {
+						unsubmitted -= static_cast<unsigned>(submitted);
+						return;
+					}
+					if (errno != EINTR) {
+						const auto error = errno;
+						ErrorManager::throwExceptionWithDebugInfo(failedWrite() ? ErrorName::FileWriteFailed : ErrorName::FileReadFailed,
+																  std::system_category().message(error), fileName);
+					}
+				}
+			}
+
+			/// Move finished requests from the completion queue to \p finished and restart requests that transferred only part of their bytes
+			void collect(std::vector<std::unique_ptr<AsyncFile::Request>>& finished) {
+				auto head = *cqHead;
+				const auto tail = std::atomic_ref {*cqTail}.load(std::memory_order_acquire);
+				finished.reserve(finished.size() + (tail - head));
+				for (; head != tail; ++head) {
+					const auto& cqe = cqes[head & cqMask];
+					auto* request = reinterpret_cast<AsyncFile::Request*>(cqe.user_data);	 // NOLINT(performance-no-int-to-ptr)
+					const auto result = cqe.res;
+					if (result < 0 && result != -EINTR && result != -EAGAIN) {
+						request->error = -result;
+					} else if (result > 0) {
+						request->transferred += static_cast<std::size_t>(result);
+					}
+					if (request->error == 0 && request->transferred < request->length) {
+						if (result != 0) {
+							prepare(request);
+							continue;
+						}
+						// end of file for reads, writes of zero bytes are unexpected
+						if (request->write) {
+							request->error = ShortWrite;
+						}
+					}
+					if (request->write) {
+						--writesInFlight;
+					}
+					finished.emplace_back(request);
+				}
+				std::atomic_ref {*cqHead}.store(head, std::memory_order_release);
+			}
+
+			/// Whether a failed io_uring_enter affected a write: the first entry the kernel did not take, or any request in flight if all entries were taken
+			[[nodiscard]] bool failedWrite() const {
+				if (unsubmitted > 0) {
+					const auto& next = sqes[sqArray[(*sqTail - unsubmitted) & sqMask]];
+					return next.opcode == IORING_OP_WRITE;
+				}
+				return writesInFlight > 0;
+			}
+
+			std::unique_ptr<Ring> ring;
+			const std::string& fileName;
+			unsigned* sqTail = nullptr;
+			unsigned sqMask = 0;
+			unsigned* sqArray = nullptr;
+			io_uring_sqe* sqes = nullptr;
+			unsigned* cqHead = nullptr;
+			unsigned* cqTail = nullptr;
+			unsigned cqMask = 0;
+			io_uring_cqe* cqes = nullptr;
+
+			/// Number of entries added to the submission queue and not yet submitted
+			unsigned unsubmitted = 0;
+
+			/// Number of started write requests which have not finished yet
+			unsigned writesInFlight = 0;
+		};
+#endif
+	}  // namespace
+
+	AsyncFile::AsyncFile(const std::string& fileName, std::ios::openmode mode, unsigned queueDepth, AsyncBackend backend)
+		: fileName {fileName}, depth {std::max(queueDepth, 1U)} {
+		const auto file = openHandle(fileName, mode);
+#ifdef LLU_ASYNCFILE_IO_URING
+		if (backend != AsyncBackend::ThreadPool) {
+			if (auto ring = setupRing(depth)) {
+				engine = std::make_unique<IoUringEngine>(file, std::move(ring), this->fileName);
+				engineType = AsyncBackend::IoUring;
+			}
+		}
+#else
+		static_cast<void>(backend);
+#endif
+		if (!engine) {
+			engine = std::make_unique<ThreadPoolEngine>(file, depth);
+		}
+	}
+
+	AsyncFile::~AsyncFile() {
+		queued.clear();
+		// the system may still access the buffers of requests in flight, so all of them must finish before the engine is destroyed
+		std::vector<std::unique_ptr<Request>> finished;
+		while (inFlight > 0) {
+			finished.clear();
+			try {
+				engine->reap(true, finished);
+			} catch (...) {
+				// requests reaped before the failure are in finished, keep waiting for the rest
+			}
+			inFlight -= finished.size();
+		}
+	}
+
+	void AsyncFile::readAt(std::uint64_t offset, std::span<std::byte> buffer, Completion onDone) {
+		enqueue(std::make_unique<Request>(Request {buffer.data(), buffer.size(), offset, false, std::move(onDone)}));
+	}
+
+	void AsyncFile::writeAt(std::uint64_t offset, std::span<const std::byte> buffer, Completion onDone) {
+		// NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast): the buffer of a write request is only read from
+		enqueue(std::make_unique<Request>(Request {const_cast<std::byte*>(buffer.data()), buffer.size(), offset, true, std::move(onDone)}));
+	}
+
+	void AsyncFile::enqueue(std::unique_ptr<Request> request) {
+		queued.push_back(std::move(request));
+		if (queued.size() >= depth) {
+			submit();
+		}
+	}
+
+	void AsyncFile::submit() {
+		while (inFlight < depth && !queued.empty()) {
+			engine->start(queued.front().release());
+			queued.pop_front();
+			++inFlight;
+		}
+		engine->flush();
+	}
+
+	std::size_t AsyncFile::complete(bool block) {
+		std::vector<std::unique_ptr<Request>> finished;
+		try {
+			engine->reap(block, finished);
+		} catch (...) {
+			// requests reaped before the failure are no longer in flight, otherwise the destructor would wait for them forever
+			inFlight -= finished.size();
+			throw;
+		}
+		inFlight -= finished.size();
+		// keep the queue full while completions run
+		submit();
+		const Request* failed = nullptr;
+		for (const auto& request : finished) {
+			if (request->error != 0) {
+				failed = failed ? failed : request.get();
+			} else if (request->onDone) {
+				request->onDone(request->transferred);
+			}
+		}
+		if (failed) {
+			ErrorManager::throwExceptionWithDebugInfo(failed->write ? ErrorName::FileWriteFailed : ErrorName::FileReadFailed,
+													  std::system_category().message(failed->error), fileName);
+		}
+		return finished.size();
+	}
+
+	std::size_t AsyncFile::poll() {
+		submit();
+		return inFlight > 0 ? complete(false) : 0;
+	}
+
+	void AsyncFile::wait() {
+		submit();
+		while (pending() > 0) {
+			complete(true);
+		}
+	}
+
+}  // namespace LLU
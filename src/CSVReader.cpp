@@ -0,0 +1,485 @@
+/**
+ * @file	CSVReader.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of the parallel delimited text reader.
+ */
+
+#include "LLU/CSVReader.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <string>
+#include <version>
+
+#ifndef __cpp_lib_to_chars
+#include <clocale>
+#ifdef __APPLE__
+#include <xlocale.h>
+#endif
+#endif
+
+#include "LLU/Containers/DataVectorBuilder.h"
+#include "LLU/Containers/DataVectorKernels.h"
+#include "LLU/Containers/MappedArray.h"
+#include "LLU/Containers/ValidityBitmap.h"
+
+namespace LLU::CSV {
+
+	namespace {
+		/// Date granularity of TabularColumns storing days since 1970-01-01, this is DAY_GRANULARITY of the LibraryLink TabularColumn API
+		/// (TabularColumn_newDate), which is not available as a named constant in the WolframLibrary headers
+		constexpr mint DayGranularity = -40;
+
+		/// Bits of column type candidates, a column has the first type whose bit survives all of its values
+		enum TypeBit : unsigned { IntegerBit = 1U, RealBit = 2U, BooleanBit = 4U, DateBit = 8U, AllBits = 15U };
+
+		bool parseInteger(std::string_view s, std::int64_t& value) {
+			const auto* end = s.data() + s.size();
+			auto [ptr, ec] = std::from_chars(s.data(), end, value);
+			return ec == std::errc {} && ptr == end;
+		}
+
+		bool parseReal(std::string_view s, double& value) {
+#ifdef __cpp_lib_to_chars
+			const auto* end = s.data() + s.size();
+			auto [ptr, ec] = std::from_chars(s.data(), end, value);
+			return ec == std::errc {} && ptr == end;
+#else
+			// floating-point std::from_chars is missing from libc++ for older macOS deployment targets, so use strtod with the "C" locale,
+			// rejecting the input that strtod accepts but from_chars does not (leading white space or plus sign, hexadecimal numbers)
+			static const locale_t cLocale = newlocale(LC_ALL_MASK, "C", nullptr);
+			if (s.empty() || s.front() == '+' || s.find_first_of(" \t\n\v\f\rxX") != std::string_view::npos) {
+				return false;
+			}
+			std::array<char, 64> shortBuffer {};
+			std::string longBuffer;
+			const char* str = nullptr;
+			if (s.size() < shortBuffer.size()) {
+				std::copy(s.begin(), s.end(), shortBuffer.begin());
+				str = shortBuffer.data();
+			} else {
+				longBuffer.assign(s);
+				str = longBuffer.c_str();
+			}
+			char* end = nullptr;
+			errno = 0;
+			value = strtod_l(str, &end, cLocale);
+			return errno != ERANGE && end == str + s.size();
+#endif
+		}
+
+		bool parseBoolean(std::string_view s, std::int8_t& value) {
+			if (s == "True" || s == "true" || s == "TRUE") {
+				value = 1;
+				return true;
+			}
+			if (s == "False" || s == "false" || s == "FALSE") {
+				value = 0;
+				return true;
+			}
+			return false;
+		}
+
+		bool parseDate(std::string_view s, std::int32_t& days) {
+			int y = 0;
+			unsigned m = 0;
+			unsigned d = 0;
+			if (s.size() != 10 || s[4] != '-' || s[7] != '-') {
+				return false;
+			}
+			const auto* p = s.data();
+			if (std::from_chars(p, p + 4, y).ptr != p + 4 || std::from_chars(p + 5, p + 7, m).ptr != p + 7 || std::from_chars(p + 8, p + 10, d).ptr != p + 10) {
+				return false;
+			}
+			const std::chrono::year_month_day date {std::chrono::year {y}, std::chrono::month {m}, std::chrono::day {d}};
+			if (!date.ok()) {
+				return false;
+			}
+			days = static_cast<std::int32_t>(std::chrono::sys_days {date}.time_since_epoch().count());
+			return true;
+		}
+
+		/// Remove types that cannot represent \p s from \p candidates
+		unsigned narrow(unsigned candidates, std::string_view s) {
+			std::int64_t i = 0;
+			double r = 0.0;
+			std::int8_t b = 0;
+			std::int32_t d = 0;
+			if ((candidates & IntegerBit) != 0 && !parseInteger(s, i)) {
+				candidates &= ~IntegerBit;
+			}
+			if ((candidates & RealBit) != 0 && (candidates & IntegerBit) == 0 && !parseReal(s, r)) {
+				candidates &= ~RealBit;
+			}
+			if ((candidates & BooleanBit) != 0 && !parseBoolean(s, b)) {
+				candidates &= ~BooleanBit;
+			}
+			if ((candidates & DateBit) != 0 && !parseDate(s, d)) {
+				candidates &= ~DateBit;
+			}
+			return candidates;
+		}
+
+		ColumnType typeOf(unsigned candidates) {
+			if ((candidates & IntegerBit) != 0) {
+				return ColumnType::Integer;
+			}
+			if ((candidates & RealBit) != 0) {
+				return ColumnType::Real;
+			}
+			if ((candidates & BooleanBit) != 0) {
+				return ColumnType::Boolean;
+			}
+			if ((candidates & DateBit) != 0) {
+				return ColumnType::Date;
+			}
+			return ColumnType::String;
+		}
+
+		/// A field of a record, quoted empty fields are empty strings rather than missing values
+		struct Field {
+			std::string_view text;
+			bool quoted = false;
+
+			[[nodiscard]] bool missing() const noexcept {
+				return text.empty() && !quoted;
+			}
+		};
+
+		/// Splits records into fields, unescaping quoted fields when needed
+		class RecordParser {
+		public:
+			RecordParser(std::string_view text, const Options& options) : text {text}, delimiter {options.delimiter}, quote {options.quote} {}
+
+			/// Check if the record starting at \p pos is an empty line
+			[[nodiscard]] bool emptyLine(std::size_t pos) const noexcept {
+				return text[pos] == '\n' || (text[pos] == '\r' && pos + 1 < text.size() && text[pos + 1] == '\n');
+			}
+
+			/// Get the position after the end of the line starting at \p pos
+			[[nodiscard]] std::size_t skipLine(std::size_t pos) const noexcept {
+				return std::min(text.find('\n', pos), text.size() - 1) + 1;
+			}
+
+			/**
+			 * @brief   Parse the record starting at \p pos
+			 * @param   pos - position of the first character of the record
+			 * @param   fields - receives the fields, views either into the text or into \p arena
+			 * @param   arena - storage for fields with escaped quotes
+			 * @return  position of the next record
+			 */
+			std::size_t parse(std::size_t pos, std::vector<Field>& fields, std::deque<std::string>& arena) const {
+				const auto n = text.size();
+				fields.clear();
+				auto i = pos;
+				while (true) {
+					std::string_view field;
+					const bool quoted = i < n && text[i] == quote;
+					if (quoted) {
+						const auto start = ++i;
+						bool escaped = false;
+						while (true) {
+							const auto q = text.find(quote, i);
+							if (q == std::string_view::npos) {
+								// unterminated quote, the field extends to the end of the text
+								field = text.substr(start);
+								i = n;
+								break;
+							}
+							if (q + 1 < n && text[q + 1] == quote) {
+								escaped = true;
+								i = q + 2;
+								continue;
+							}
+							field = text.substr(start, q - start);
+							i = q + 1;
+							break;
+						}
+						if (escaped) {
+							field = arena.emplace_back(unescape(field));
+						}
+						// characters between the closing quote and the end of the field are ignored
+						while (i < n && text[i] != delimiter && text[i] != '\n') {
+							++i;
+						}
+					} else {
+						auto end = i;
+						while (end < n && text[end] != delimiter && text[end] != '\n') {
+							++end;
+						}
+						field = text.substr(i, end - i);
+						i = end;
+						if ((i == n || text[i] == '\n') && !field.empty() && field.back() == '\r') {
+							field.remove_suffix(1);
+						}
+					}
+					fields.push_back({field, quoted});
+					if (i >= n) {
+						return n;
+					}
+					if (text[i] == '\n') {
+						return i + 1;
+					}
+					++i;
+				}
+			}
+
+		private:
+			[[nodiscard]] std::string unescape(std::string_view field) const {
+				std::string result;
+				result.reserve(field.size());
+				for (std::size_t i = 0; i < field.size(); ++i) {
+					result.push_back(field[i]);
+					if (field[i] == quote) {
+						++i;
+					}
+				}
+				return result;
+			}
+
+			std::string_view text;
+			char delimiter;
+			char quote;
+		};
+
+		/// Records parsed from a part of the text
+		struct Chunk {
+			/// Fields of all records in row-major order
+			std::vector<Field> cells;
+
+			/// Storage for fields with escaped quotes
+			std::deque<std::string> arena;
+
+			/// Type candidates of each column
+			std::vector<unsigned> candidates;
+
+			/// Values of non-string columns converted to numbers
+			std::vector<std::vector<std::int64_t>> integers;
+			std::vector<std::vector<double>> reals;
+			std::vector<DV::ValidityBitmap> validity;
+
+			/// Number of records
+			std::size_t rows = 0;
+		};
+
+		/// Parse records in [begin, end) into \p chunk, \p begin must be a record boundary
+		void parseRecords(const RecordParser& parser, std::size_t begin, std::size_t end, std::size_t columnCount, Chunk& chunk) {
+			std::vector<Field> fields;
+			chunk.candidates.assign(columnCount, AllBits);
+			auto pos = begin;
+			while (pos < end) {
+				if (parser.emptyLine(pos)) {
+					pos = parser.skipLine(pos);
+					continue;
+				}
+				pos = parser.parse(pos, fields, chunk.arena);
+				fields.resize(columnCount);
+				for (std::size_t c = 0; c < columnCount; ++c) {
+					if (!fields[c].missing() && chunk.candidates[c] != 0) {
+						// only String columns can hold the empty string of a quoted empty field
+						chunk.candidates[c] = fields[c].text.empty() ? 0U : narrow(chunk.candidates[c], fields[c].text);
+					}
+				}
+				chunk.cells.insert(chunk.cells.end(), fields.begin(), fields.end());
+				++chunk.rows;
+			}
+		}
+
+		/// Convert the cells of non-string columns of a chunk to numbers
+		void convertValues(Chunk& chunk, const std::vector<ColumnType>& types) {
+			const auto columnCount = types.size();
+			chunk.integers.resize(columnCount);
+			chunk.reals.resize(columnCount);
+			chunk.validity.resize(columnCount);
+			for (std::size_t c = 0; c < columnCount; ++c) {
+				if (types[c] == ColumnType::String) {
+					continue;
+				}
+				auto& valid = chunk.validity[c];
+				valid.reserve(chunk.rows);
+				if (types[c] == ColumnType::Real) {
+					chunk.reals[c].resize(chunk.rows);
+				} else {
+					chunk.integers[c].resize(chunk.rows);
+				}
+				for (std::size_t r = 0; r < chunk.rows; ++r) {
+					const auto& cell = chunk.cells[r * columnCount + c];
+					valid.append(!cell.missing());
+					if (cell.missing()) {
+						continue;
+					}
+					switch (types[c]) {
+						case ColumnType::Integer: parseInteger(cell.text, chunk.integers[c][r]); break;
+						case ColumnType::Real: parseReal(cell.text, chunk.reals[c][r]); break;
+						case ColumnType::Boolean: {
+							std::int8_t b = 0;
+							parseBoolean(cell.text, b);
+							chunk.integers[c][r] = b;
+							break;
+						}
+						case ColumnType::Date: {
+							std::int32_t d = 0;
+							parseDate(cell.text, d);
+							chunk.integers[c][r] = d;
+							break;
+						}
+						case ColumnType::String: break;
+					}
+				}
+			}
+		}
+
+		/// Append values of column \p c from all chunks to a fixed-width builder
+		template<typename Builder, typename Values>
+		void appendValues(Builder& builder, const std::vector<Chunk>& chunks, std::size_t c, Values&& valuesOf) {
+			for (const auto& chunk : chunks) {
+				const auto& values = valuesOf(chunk);
+				const auto& valid = chunk.validity[c];
+				if (valid.allValid()) {
+					builder.appendRange(values);
+					continue;
+				}
+				for (std::size_t r = 0; r < values.size(); ++r) {
+					if (valid[r]) {
+						builder.append(values[r]);
+					} else {
+						builder.appendNull();
+					}
+				}
+			}
+		}
+
+		DataVector buildColumn(const std::vector<Chunk>& chunks, std::size_t c, std::size_t columnCount, ColumnType type, mint rows) {
+			switch (type) {
+				case ColumnType::Integer: {
+					NumericColumnBuilder<std::int64_t> builder {rows};
+					appendValues(builder, chunks, c, [c](const Chunk& chunk) -> const auto& { return chunk.integers[c]; });
+					return builder.finish();
+				}
+				case ColumnType::Real: {
+					NumericColumnBuilder<double> builder {rows};
+					appendValues(builder, chunks, c, [c](const Chunk& chunk) -> const auto& { return chunk.reals[c]; });
+					return builder.finish();
+				}
+				case ColumnType::Boolean: {
+					BooleanColumnBuilder builder {rows};
+					for (const auto& chunk : chunks) {
+						for (std::size_t r = 0; r < chunk.rows; ++r) {
+							chunk.validity[c][r] ? builder.append(chunk.integers[c][r] != 0) : builder.appendNull();
+						}
+					}
+					return builder.finish();
+				}
+				case ColumnType::Date: {
+					DateColumnBuilder<std::int32_t> builder {DayGranularity, -1};
+					builder.reserve(rows);
+					for (const auto& chunk : chunks) {
+						for (std::size_t r = 0; r < chunk.rows; ++r) {
+							chunk.validity[c][r] ? builder.append(static_cast<std::int32_t>(chunk.integers[c][r])) : builder.appendNull();
+						}
+					}
+					return builder.finish();
+				}
+				case ColumnType::String: break;
+			}
+			mint charCount = 0;
+			for (const auto& chunk : chunks) {
+				for (std::size_t r = 0; r < chunk.rows; ++r) {
+					charCount += static_cast<mint>(chunk.cells[r * columnCount + c].text.size());
+				}
+			}
+			StringColumnBuilder builder {rows, charCount};
+			for (const auto& chunk : chunks) {
+				for (std::size_t r = 0; r < chunk.rows; ++r) {
+					const auto& cell = chunk.cells[r * columnCount + c];
+					cell.missing() ? builder.appendNull() : builder.append(cell.text);
+				}
+			}
+			return builder.finish();
+		}
+	}  // namespace
+
+	Table parse(std::string_view text, const Options& options) {
+		Table table;
+		const RecordParser parser {text, options};
+		std::deque<std::string> headerArena;
+		std::vector<Field> fields;
+
+		// The first record determines the number of columns
+		std::size_t start = 0;
+		while (start < text.size() && parser.emptyLine(start)) {
+			start = parser.skipLine(start);
+		}
+		if (start == text.size()) {
+			return table;
+		}
+		const auto afterFirst = parser.parse(start, fields, headerArena);
+		const auto columnCount = fields.size();
+		if (options.header) {
+			std::transform(fields.begin(), fields.end(), std::back_inserter(table.names), [](const Field& f) { return std::string {f.text}; });
+			start = afterFirst;
+		} else {
+			table.names.assign(columnCount, std::string {});
+		}
+
+		// Count quotes in each part of the text, so that every thread knows whether its part starts inside a quoted field
+		const auto body = text.size() - start;
+		const auto partCount = DV::Detail::chunkCount(body, options.threadCount);
+		std::vector<std::size_t> quoteCounts(partCount);
+		DV::Detail::forEachChunk(body, partCount, [&](std::size_t c, std::size_t begin, std::size_t end) {
+			// std::count over contiguous chars is vectorized by the compiler
+			const auto part = text.substr(start + begin, end - begin);
+			quoteCounts[c] = static_cast<std::size_t>(std::count(part.begin(), part.end(), options.quote));
+		});
+
+		// Each thread parses the records which start in its part of the text
+		std::vector<Chunk> chunks(partCount);
+		DV::Detail::forEachChunk(body, partCount, [&](std::size_t c, std::size_t begin, std::size_t end) {
+			std::size_t quotesBefore = 0;
+			for (std::size_t k = 0; k < c; ++k) {
+				quotesBefore += quoteCounts[k];
+			}
+			auto pos = start + begin;
+			if (c > 0 && !(text[pos - 1] == '\n' && quotesBefore % 2 == 0)) {
+				// move to the first new line outside of quotes
+				bool quoted = quotesBefore % 2 != 0;
+				while (pos < start + end && (quoted || text[pos] != '\n')) {
+					quoted ^= (text[pos] == options.quote);
+					++pos;
+				}
+				++pos;
+			}
+			parseRecords(parser, std::min(pos, start + end), start + end, columnCount, chunks[c]);
+		});
+
+		std::vector<unsigned> candidates(columnCount, AllBits);
+		mint rows = 0;
+		for (const auto& chunk : chunks) {
+			std::transform(candidates.begin(), candidates.end(), chunk.candidates.begin(), candidates.begin(), [](auto a, auto b) { return a & b; });
+			rows += static_cast<mint>(chunk.rows);
+		}
+		std::transform(candidates.begin(), candidates.end(), std::back_inserter(table.types), typeOf);
+
+		DV::Detail::forEachChunk(partCount, partCount, [&](std::size_t c, std::size_t, std::size_t) { convertValues(chunks[c], table.types); });
+
+		// DataVectors are created on the calling thread, because LibraryLink callbacks must not be called from other threads
+		table.columns.reserve(columnCount);
+		for (std::size_t c = 0; c < columnCount; ++c) {
+			table.columns.push_back(buildColumn(chunks, c, columnCount, table.types[c], rows));
+		}
+		return table;
+	}
+
+	Table read(const std::string& fileName, const Options& options) {
+		const MappedFile file {fileName};
+		file.advise(MappedAccess::Sequential);
+		return parse({reinterpret_cast<const char*>(file.data()), file.size()}, options);	 // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+	}
+
+}  // namespace LLU::CSV
@@ -0,0 +1,176 @@
+/**
+ * @file	ChunkReader.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of ChunkReader and DelimitedChunkReader.
+ */
+
+#include "LLU/ChunkReader.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "LLU/Containers/DataVectorBuilder.h"
+
+namespace LLU {
+
+	ChunkReader::ChunkReader(const std::string& fileName, std::size_t chunkSize)
+		: fileName {fileName}, file {openFile(fileName, std::ios::in | std::ios::binary)}, chunkLength {std::max<std::size_t>(chunkSize, 1)} {
+		for (std::size_t b = 0; b < buffers.size(); ++b) {
+			storage[b].resize(chunkLength);
+			buffers[b] = storage[b];
+		}
+		start();
+	}
+
+	ChunkReader::ChunkReader(const std::string& fileName, std::span<char> first, std::span<char> second)
+		: fileName {fileName}, file {openFile(fileName, std::ios::in | std::ios::binary)}, chunkLength {first.size()}, buffers {first, second} {
+		if (first.empty() || second.size() != first.size()) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::FileReadFailed, "Chunk buffers must be non-empty and of equal size", fileName);
+		}
+		start();
+	}
+
+	void ChunkReader::start() {
+		worker = std::jthread {[this](const std::stop_token& stop) { readAhead(stop); }};
+	}
+
+	ChunkReader::~ChunkReader() {
+		worker.request_stop();
+	}
+
+	void ChunkReader::readAhead(const std::stop_token& stop) {
+		std::size_t next = 0;
+		while (true) {
+			{
+				std::unique_lock lock {mutex};
+				// a buffer is free when it is neither waiting to be returned by next() nor held by the caller
+				if (!bufferStateChanged.wait(lock, stop, [this] { return ready + (held ? 1 : 0) < buffers.size(); })) {
+					return;
+				}
+			}
+			auto& buffer = buffers[next];
+			const auto count = std::fread(buffer.data(), 1, chunkLength, file.get());
+			std::scoped_lock lock {mutex};
+			if (count > 0) {
+				filled[next] = count;
+				++ready;
+				next ^= 1U;
+			}
+			if (count < chunkLength) {
+				// errors are reported by next(), because LibraryLinkErrors must not be created outside of the main thread
+				readFailed = std::ferror(file.get()) != 0;
+				finished = true;
+			}
+			bufferStateChanged.notify_all();
+			if (finished) {
+				return;
+			}
+		}
+	}
+
+	std::span<const char> ChunkReader::next() {
+		std::unique_lock lock {mutex};
+		if (held) {
+			held = false;
+			bufferStateChanged.notify_all();
+		}
+		bufferStateChanged.wait(lock, [this] { return ready > 0 || finished; });
+		if (ready == 0) {
+			if (readFailed) {
+				ErrorManager::throwException(ErrorName::FileReadFailed, fileName);
+			}
+			return {};
+		}
+		--ready;
+		held = true;
+		current ^= 1U;
+		return {buffers[current].data(), filled[current]};
+	}
+
+	void ChunkReader::replaceCurrentBuffer(std::span<char> buffer) {
+		// the background thread never touches the buffer held by the caller, but it reads the other element of buffers concurrently
+		std::scoped_lock lock {mutex};
+		buffers[current] = buffer;
+	}
+
+	DelimitedChunkReader::DelimitedChunkReader(const std::string& fileName, char delimiter, std::size_t chunkSize)
+		: reader {fileName, chunkSize}, delimiter {delimiter} {}
+
+	std::string_view DelimitedChunkReader::nextRecords() {
+		while (true) {
+			const auto chunk = reader.next();
+			if (chunk.empty()) {
+				// the last record does not have to end with a new line
+				records.swap(carry);
+				carry.clear();
+				return records;
+			}
+			const auto view = std::string_view {chunk.data(), chunk.size()};
+			const auto lastNewLine = view.rfind('\n');
+			if (lastNewLine == std::string_view::npos) {
+				carry.append(view);
+				continue;
+			}
+			records.assign(carry);
+			records.append(view.substr(0, lastNewLine + 1));
+			carry.assign(view.substr(lastNewLine + 1));
+			return records;
+		}
+	}
+
+	bool DelimitedChunkReader::read(std::vector<DataVector>& columns) {
+		std::vector<std::string_view> fields;
+		const auto splitRecord = [&](std::string_view record) {
+			fields.clear();
+			std::size_t begin = 0;
+			while (true) {
+				const auto end = record.find(delimiter, begin);
+				fields.push_back(record.substr(begin, end == std::string_view::npos ? std::string_view::npos : end - begin));
+				if (end == std::string_view::npos) {
+					return;
+				}
+				begin = end + 1;
+			}
+		};
+		std::vector<StringColumnBuilder> builders(columnTotal);
+		// a chunk may consist of empty lines only, so keep reading until at least one record is found or the file ends
+		std::size_t recordCount = 0;
+		while (recordCount == 0) {
+			auto text = nextRecords();
+			if (text.empty()) {
+				return false;
+			}
+			while (!text.empty()) {
+				const auto lineEnd = std::min(text.find('\n'), text.size());
+				auto record = text.substr(0, lineEnd);
+				text.remove_prefix(std::min(lineEnd + 1, text.size()));
+				if (!record.empty() && record.back() == '\r') {
+					record.remove_suffix(1);
+				}
+				if (record.empty()) {
+					continue;
+				}
+				splitRecord(record);
+				if (columnTotal == 0) {
+					columnTotal = fields.size();
+					builders.resize(columnTotal);
+				}
+				for (std::size_t c = 0; c < columnTotal; ++c) {
+					if (c < fields.size() && !fields[c].empty()) {
+						builders[c].append(fields[c]);
+					} else {
+						builders[c].appendNull();
+					}
+				}
+				++recordCount;
+			}
+		}
+		columns.clear();
+		columns.reserve(columnTotal);
+		for (auto& b : builders) {
+			columns.push_back(b.finish());
+		}
+		return true;
+	}
+
+}  // namespace LLU
@@ -0,0 +1,541 @@
+/**
+ * @file	Compression.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of NumericArray compression with LZ4 and shuffle filters.
+ */
+
+#include "LLU/Compression.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "LLU/Async/ThreadPool.h"
+#include "LLU/Containers/DataVectorKernels.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::NA {
+
+	namespace {
+		using Bytes = std::vector<std::uint8_t>;
+
+		constexpr std::array<std::uint8_t, 4> Magic {'L', 'L', 'U', 'Z'};
+		constexpr std::uint8_t FormatVersion = 1;
+
+		/// LZ4 block format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md
+		namespace LZ4 {
+			constexpr std::size_t MinMatch = 4;
+			/// The last 5 bytes of a block are always literals
+			constexpr std::size_t LastLiterals = 5;
+			/// The last match must start at least 12 bytes before the end of the block
+			constexpr std::size_t MatchStartLimit = 12;
+			constexpr std::size_t MaxOffset = 65535;
+			constexpr unsigned HashLog = 16;
+
+			std::uint32_t read32(const std::uint8_t* p) noexcept {
+				std::uint32_t result;
+				std::memcpy(&result, p, sizeof(result));
+				return result;
+			}
+
+			std::uint32_t hash(std::uint32_t sequence) noexcept {
+				return (sequence * 2654435761U) >> (32 - HashLog);
+			}
+
+			/// Upper bound of the compressed size of \p size bytes
+			std::size_t bound(std::size_t size) noexcept {
+				return size + size / 255 + 16;
+			}
+
+			void putLength(Bytes& out, std::size_t length) {
+				for (; length >= 255; length -= 255) {
+					out.push_back(255);
+				}
+				out.push_back(static_cast<std::uint8_t>(length));
+			}
+
+			void putSequence(Bytes& out, const std::uint8_t* literals, std::size_t literalCount, std::size_t offset, std::size_t matchLength) {
+				const auto matchCode = matchLength - MinMatch;
+				out.push_back(static_cast<std::uint8_t>((std::min<std::size_t>(literalCount, 15) << 4U) | std::min<std::size_t>(matchCode, 15)));
+				if (literalCount >= 15) {
+					putLength(out, literalCount - 15);
+				}
+				out.insert(out.end(), literals, literals + literalCount);
+				out.push_back(static_cast<std::uint8_t>(offset & 0xFFU));
+				out.push_back(static_cast<std::uint8_t>(offset >> 8U));
+				if (matchCode >= 15) {
+					putLength(out, matchCode - 15);
+				}
+			}
+
+			void putLastLiterals(Bytes& out, const std::uint8_t* literals, std::size_t literalCount) {
+				out.push_back(static_cast<std::uint8_t>(std::min<std::size_t>(literalCount, 15) << 4U));
+				if (literalCount >= 15) {
+					putLength(out, literalCount - 15);
+				}
+				out.insert(out.end(), literals, literals + literalCount);
+			}
+
+			/**
+			 * Compress a block with a hash table of recent positions. Level 1 checks a single candidate and skips faster over incompressible data,
+			 * higher levels follow a chain of earlier positions with the same hash, up to 2^(level - 1) candidates.
+			 */
+			void compress(std::span<const std::uint8_t> in, int level, Bytes& out) {
+				out.clear();
+				out.reserve(bound(in.size()));
+				const auto* src = in.data();
+				const auto size = in.size();
+				if (size <= MatchStartLimit) {
+					putLastLiterals(out, src, size);
+					return;
+				}
+				const auto maxAttempts = 1U << static_cast<unsigned>(level - 1);
+				const auto searchEnd = size - MatchStartLimit;
+				const auto matchLimit = size - LastLiterals;
+				std::vector<std::int64_t> head(std::size_t {1} << HashLog, -1);
+				std::vector<std::uint16_t> chain(maxAttempts > 1 ? MaxOffset + 1 : 0);
+
+				const auto insert = [&](std::size_t pos) {
+					auto& last = head[hash(read32(src + pos))];
+					if (!chain.empty()) {
+						const auto distance = last < 0 ? 0 : pos - static_cast<std::size_t>(last);
+						chain[pos & MaxOffset] = static_cast<std::uint16_t>(distance <= MaxOffset ? distance : 0);
+					}
+					last = static_cast<std::int64_t>(pos);
+				};
+
+				std::size_t anchor = 0;
+				std::size_t ip = 0;
+				while (ip <= searchEnd) {
+					const auto sequence = read32(src + ip);
+					std::size_t bestLength = 0;
+					std::size_t bestPos = 0;
+					auto candidate = head[hash(sequence)];
+					for (auto attempt = 0U; candidate >= 0 && attempt < maxAttempts; ++attempt) {
+						const auto cand = static_cast<std::size_t>(candidate);
+						if (ip - cand > MaxOffset) {
+							break;
+						}
+						if (read32(src + cand) == sequence) {
+							auto length = MinMatch;
+							while (ip + length < matchLimit && src[cand + length] == src[ip + length]) {
+								++length;
+							}
+							if (length > bestLength) {
+								bestLength = length;
+								bestPos = cand;
+							}
+						}
+						if (chain.empty() || chain[cand & MaxOffset] == 0) {
+							break;
+						}
+						candidate -= chain[cand & MaxOffset];
+					}
+					insert(ip);
+					if (bestLength < MinMatch || ip + bestLength > matchLimit) {
+						ip += (maxAttempts > 1) ? 1 : 1 + ((ip - anchor) >> 6U);
+						continue;
+					}
+					while (ip > anchor && bestPos > 0 && src[ip - 1] == src[bestPos - 1]) {
+						--ip;
+						--bestPos;
+						++bestLength;
+					}
+					putSequence(out, src + anchor, ip - anchor, ip - bestPos, bestLength);
+					const auto matchEnd = ip + bestLength;
+					for (auto pos = (maxAttempts > 1) ? ip + 1 : matchEnd - 2; pos < matchEnd && pos <= searchEnd; ++pos) {
+						insert(pos);
+					}
+					ip = anchor = matchEnd;
+				}
+				putLastLiterals(out, src + anchor, size - anchor);
+			}
+
+			/// Decompress a block which must expand to exactly out.size() bytes, return false if the block is malformed
+			bool decompress(std::span<const std::uint8_t> in, std::span<std::uint8_t> out) noexcept {
+				std::size_t ip = 0;
+				std::size_t op = 0;
+				const auto getLength = [&](std::size_t& length) {
+					std::uint8_t b = 255;
+					while (b == 255) {
+						if (ip >= in.size()) {
+							return false;
+						}
+						b = in[ip++];
+						length += b;
+					}
+					return true;
+				};
+				while (ip < in.size()) {
+					const auto token = in[ip++];
+					std::size_t literalCount = token >> 4U;
+					if ((literalCount == 15 && !getLength(literalCount)) || literalCount > in.size() - ip || literalCount > out.size() - op) {
+						return false;
+					}
+					std::memcpy(out.data() + op, in.data() + ip, literalCount);
+					ip += literalCount;
+					op += literalCount;
+					if (ip == in.size()) {
+						break;
+					}
+					if (in.size() - ip < 2) {
+						return false;
+					}
+					const std::size_t offset = in[ip] | (std::size_t {in[ip + 1]} << 8U);
+					ip += 2;
+					std::size_t matchLength = token & 0x0FU;
+					if (offset == 0 || offset > op || (matchLength == 15 && !getLength(matchLength))) {
+						return false;
+					}
+					matchLength += MinMatch;
+					if (matchLength > out.size() - op) {
+						return false;
+					}
+					// the match may overlap the bytes it produces, so it is copied byte by byte unless the regions are disjoint
+					if (offset >= matchLength) {
+						std::memcpy(out.data() + op, out.data() + op - offset, matchLength);
+						op += matchLength;
+					} else {
+						for (const auto end = op + matchLength; op < end; ++op) {
+							out[op] = out[op - offset];
+						}
+					}
+				}
+				return op == out.size();
+			}
+		}  // namespace LZ4
+
+		/// Store byte b of element i at position b * count + i
+		void shuffle(std::span<const std::uint8_t> in, std::size_t elemSize, std::uint8_t* out) noexcept {
+			const auto count = in.size() / elemSize;
+			for (std::size_t i = 0; i < count; ++i) {
+				for (std::size_t b = 0; b < elemSize; ++b) {
+					out[b * count + i] = in[i * elemSize + b];
+				}
+			}
+		}
+
+		void unshuffle(std::span<const std::uint8_t> in, std::size_t elemSize, std::uint8_t* out) noexcept {
+			const auto count = in.size() / elemSize;
+			for (std::size_t b = 0; b < elemSize; ++b) {
+				for (std::size_t i = 0; i < count; ++i) {
+					out[i * elemSize + b] = in[b * count + i];
+				}
+			}
+		}
+
+		/// Pack 8 bytes, each \p stride bytes apart, into an integer with the first byte in the lowest bits
+		std::uint64_t gather(const std::uint8_t* bytes, std::size_t stride) noexcept {
+			std::uint64_t x = 0;
+			for (std::size_t k = 0; k < 8; ++k) {
+				x |= std::uint64_t {bytes[k * stride]} << (8 * k);
+			}
+			return x;
+		}
+
+		/// Unpack 8 bytes of an integer, starting from the lowest ones, into memory locations \p stride bytes apart
+		void scatter(std::uint64_t x, std::uint8_t* bytes, std::size_t stride) noexcept {
+			for (std::size_t k = 0; k < 8; ++k) {
+				bytes[k * stride] = static_cast<std::uint8_t>(x >> (8 * k));
+			}
+		}
+
+		/// Transpose an 8x8 bit matrix stored in 8 bytes, so that bit j of byte i becomes bit i of byte j
+		std::uint64_t transposeBits(std::uint64_t x) noexcept {
+			auto t = (x ^ (x >> 7U)) & 0x00AA00AA00AA00AAULL;
+			x ^= t ^ (t << 7U);
+			t = (x ^ (x >> 14U)) & 0x0000CCCC0000CCCCULL;
+			x ^= t ^ (t << 14U);
+			t = (x ^ (x >> 28U)) & 0x00000000F0F0F0F0ULL;
+			x ^= t ^ (t << 28U);
+			return x;
+		}
+
+		/**
+		 * Store bit k of byte b of element i in bit plane 8 * b + k, each plane holds one bit of every element. Bit shuffling is a byte shuffle
+		 * followed by the transposition of 8x8 bit matrices within each byte plane. The block size is a multiple of 8 elements, except for the
+		 * last block of the array, whose trailing elements are only byte-shuffled.
+		 */
+		void bitShuffle(std::span<const std::uint8_t> in, std::size_t elemSize, std::uint8_t* out, std::vector<std::uint8_t>& scratch) {
+			const auto count = in.size() / elemSize;
+			scratch.resize(in.size());
+			shuffle(in, elemSize, scratch.data());
+			const auto groups = count / 8;
+			for (std::size_t b = 0; b < elemSize; ++b) {
+				const auto* plane = scratch.data() + b * count;
+				auto* planeOut = out + b * count;
+				for (std::size_t g = 0; g < groups; ++g) {
+					scatter(transposeBits(gather(plane + 8 * g, 1)), planeOut + g, groups);
+				}
+				std::copy(plane + 8 * groups, plane + count, planeOut + 8 * groups);
+			}
+		}
+
+		void bitUnshuffle(std::span<const std::uint8_t> in, std::size_t elemSize, std::uint8_t* out, std::vector<std::uint8_t>& scratch) {
+			const auto count = in.size() / elemSize;
+			scratch.resize(in.size());
+			const auto groups = count / 8;
+			for (std::size_t b = 0; b < elemSize; ++b) {
+				const auto* planeIn = in.data() + b * count;
+				auto* plane = scratch.data() + b * count;
+				for (std::size_t g = 0; g < groups; ++g) {
+					scatter(transposeBits(gather(planeIn + g, groups)), plane + 8 * g, 1);
+				}
+				std::copy(planeIn + 8 * groups, planeIn + count, plane + 8 * groups);
+			}
+			unshuffle(scratch, elemSize, out);
+		}
+
+		/// Description of compressed data, stored at its beginning
+		struct Header {
+			Codec codec = Codec::None;
+			Filter filter = Filter::None;
+			numericarray_data_t type = MNumericArray_Type_Undef;
+			std::vector<mint> dims;
+			std::uint64_t blockSize = 0;
+			std::uint64_t totalSize = 0;
+		};
+
+		template<typename T>
+		void put(Bytes& out, T value) {
+			const auto pos = out.size();
+			out.resize(pos + sizeof(T));
+			std::memcpy(out.data() + pos, &value, sizeof(T));
+		}
+
+		/// Sequential reader of compressed data which reports malformed input by returning false
+		class Input {
+		public:
+			explicit Input(std::span<const std::uint8_t> data) : data {data} {}
+
+			template<typename T>
+			bool get(T& value) noexcept {
+				if (data.size() - pos < sizeof(T)) {
+					return false;
+				}
+				std::memcpy(&value, data.data() + pos, sizeof(T));
+				pos += sizeof(T);
+				return true;
+			}
+
+			bool take(std::size_t size, std::span<const std::uint8_t>& result) noexcept {
+				if (data.size() - pos < size) {
+					return false;
+				}
+				result = data.subspan(pos, size);
+				pos += size;
+				return true;
+			}
+
+		private:
+			std::span<const std::uint8_t> data;
+			std::size_t pos = 0;
+		};
+
+		[[noreturn]] void throwCorrupted() {
+			ErrorManager::throwException(ErrorName::NumericArrayDecompressionError);
+		}
+
+		/// Element types of NumericArrays that can be compressed
+		constexpr std::array<numericarray_data_t, 12> ElementTypes {MNumericArray_Type_Bit8,	 MNumericArray_Type_UBit8,	MNumericArray_Type_Bit16,
+																	MNumericArray_Type_UBit16,	 MNumericArray_Type_Bit32,	MNumericArray_Type_UBit32,
+																	MNumericArray_Type_Bit64,	 MNumericArray_Type_UBit64, MNumericArray_Type_Real32,
+																	MNumericArray_Type_Real64,	 MNumericArray_Type_Complex_Real32,
+																	MNumericArray_Type_Complex_Real64};
+
+		std::size_t elementSize(numericarray_data_t type) {
+			return DV::Detail::visitNumericType(type, []<typename T>(std::type_identity<T>) { return sizeof(T); });
+		}
+
+		/// Run task(b) for every block, on a thread pool when there are several blocks and several threads are allowed
+		template<typename Task>
+		void forEachBlock(std::size_t blockCount, unsigned threadCount, Task&& task) {
+			if (threadCount == 0) {
+				threadCount = std::max(std::thread::hardware_concurrency(), 1U);
+			}
+			const auto poolSize = static_cast<unsigned>(std::min<std::size_t>(blockCount, threadCount));
+			if (poolSize <= 1) {
+				for (std::size_t b = 0; b < blockCount; ++b) {
+					task(b);
+				}
+				return;
+			}
+			BasicPool pool {poolSize};
+			std::vector<std::future<void>> results;
+			results.reserve(blockCount);
+			for (std::size_t b = 0; b < blockCount; ++b) {
+				results.push_back(pool.submit([&task, b] { task(b); }));
+			}
+			for (auto& r : results) {
+				r.get();
+			}
+		}
+	}  // namespace
+
+	UInt8Array compress(const NumericArrayView& array, const CompressionOptions& options) {
+		const auto elemSize = elementSize(array.type());
+		const auto totalSize = static_cast<std::size_t>(array.getFlattenedLength()) * elemSize;
+		const auto level = std::clamp(options.level, 1, 9);
+		auto filter = options.filter;
+		if (filter == Filter::Auto) {
+			filter = (elemSize == 1) ? Filter::BitShuffle : Filter::Shuffle;
+		}
+		const auto unit = 8 * elemSize;
+		const auto blockSize = std::max(options.blockSize / unit, std::size_t {1}) * unit;
+		const auto blockCount = (totalSize + blockSize - 1) / blockSize;
+		const std::span<const std::uint8_t> input {static_cast<const std::uint8_t*>(array.rawData()), totalSize};
+
+		// blocks are compressed in worker threads, which must not use the LibraryLink API, so the result is assembled afterwards
+		std::vector<Bytes> blocks(blockCount);
+		forEachBlock(blockCount, options.threadCount, [&](std::size_t b) {
+			const auto raw = input.subspan(b * blockSize, std::min(blockSize, totalSize - b * blockSize));
+			Bytes filtered;
+			Bytes scratch;
+			auto source = raw;
+			if (filter == Filter::Shuffle && elemSize > 1) {
+				filtered.resize(raw.size());
+				shuffle(raw, elemSize, filtered.data());
+				source = filtered;
+			} else if (filter == Filter::BitShuffle) {
+				filtered.resize(raw.size());
+				bitShuffle(raw, elemSize, filtered.data(), scratch);
+				source = filtered;
+			}
+			auto& out = blocks[b];
+			if (options.codec == Codec::LZ4) {
+				LZ4::compress(source, level, out);
+			} else {
+				out.assign(source.begin(), source.end());
+			}
+			// a block that does not get smaller is stored unchanged and recognized by its size
+			if (out.size() >= raw.size()) {
+				out.assign(raw.begin(), raw.end());
+			}
+		});
+
+		Bytes header;
+		header.insert(header.end(), Magic.begin(), Magic.end());
+		put(header, FormatVersion);
+		put(header, static_cast<std::uint8_t>(options.codec));
+		put(header, static_cast<std::uint8_t>(filter));
+		put(header, std::uint8_t {0});
+		put(header, static_cast<std::uint32_t>(array.type()));
+		put(header, static_cast<std::uint32_t>(array.getRank()));
+		for (mint d = 0; d < array.getRank(); ++d) {
+			put(header, static_cast<std::int64_t>(array.getDimensions()[d]));
+		}
+		put(header, static_cast<std::uint64_t>(blockSize));
+		put(header, static_cast<std::uint64_t>(totalSize));
+		std::size_t resultSize = header.size();
+		for (const auto& block : blocks) {
+			put(header, static_cast<std::uint64_t>(block.size()));
+			resultSize += sizeof(std::uint64_t) + block.size();
+		}
+
+		UInt8Array result {std::uint8_t {0}, MArrayDimensions {static_cast<mint>(resultSize)}};
+		auto* out = std::copy(header.begin(), header.end(), result.data());
+		for (const auto& block : blocks) {
+			out = std::copy(block.begin(), block.end(), out);
+		}
+		return result;
+	}
+
+	GenericNumericArray decompress(std::span<const std::uint8_t> data, unsigned threadCount) {
+		Input in {data};
+		std::array<std::uint8_t, 4> magic {};
+		std::uint8_t version = 0;
+		std::uint8_t codec = 0;
+		std::uint8_t filter = 0;
+		std::uint8_t reserved = 0;
+		std::uint32_t type = 0;
+		std::uint32_t rank = 0;
+		if (!in.get(magic) || magic != Magic || !in.get(version) || version != FormatVersion || !in.get(codec) || !in.get(filter) || !in.get(reserved) ||
+			!in.get(type) || !in.get(rank) || codec > static_cast<std::uint8_t>(Codec::LZ4) || filter > static_cast<std::uint8_t>(Filter::BitShuffle) ||
+			rank > data.size() / sizeof(std::int64_t)) {
+			throwCorrupted();
+		}
+		std::vector<mint> dims(rank);
+		std::size_t count = 1;
+		for (auto& d : dims) {
+			std::int64_t dim = 0;
+			if (!in.get(dim) || dim < 0 || (dim > 0 && count > std::numeric_limits<std::size_t>::max() / static_cast<std::size_t>(dim))) {
+				throwCorrupted();
+			}
+			d = static_cast<mint>(dim);
+			count *= static_cast<std::size_t>(dim);
+		}
+		if (std::none_of(ElementTypes.begin(), ElementTypes.end(), [type](numericarray_data_t t) { return static_cast<std::uint32_t>(t) == type; })) {
+			throwCorrupted();
+		}
+		const auto elemType = static_cast<numericarray_data_t>(type);
+		const auto elemSize = elementSize(elemType);
+		std::uint64_t blockSize = 0;
+		std::uint64_t totalSize = 0;
+		if (!in.get(blockSize) || !in.get(totalSize) || blockSize == 0 || blockSize % elemSize != 0 || count > std::numeric_limits<std::size_t>::max() / elemSize ||
+			totalSize != count * elemSize) {
+			throwCorrupted();
+		}
+		const auto blockCount = static_cast<std::size_t>((totalSize + blockSize - 1) / blockSize);
+		if (blockCount > data.size() / sizeof(std::uint64_t)) {
+			throwCorrupted();
+		}
+		std::vector<std::span<const std::uint8_t>> blocks(blockCount);
+		std::vector<std::uint64_t> sizes(blockCount);
+		for (auto& s : sizes) {
+			if (!in.get(s)) {
+				throwCorrupted();
+			}
+		}
+		for (std::size_t b = 0; b < blockCount; ++b) {
+			if (!in.take(static_cast<std::size_t>(sizes[b]), blocks[b])) {
+				throwCorrupted();
+			}
+		}
+
+		GenericNumericArray result {elemType, static_cast<mint>(rank), dims.data()};
+		const std::span<std::uint8_t> output {static_cast<std::uint8_t*>(result.rawData()), static_cast<std::size_t>(totalSize)};
+		std::vector<char> valid(blockCount, 1);
+		forEachBlock(blockCount, threadCount, [&](std::size_t b) {
+			const auto raw = output.subspan(b * blockSize, std::min<std::size_t>(blockSize, totalSize - b * blockSize));
+			const auto& block = blocks[b];
+			if (block.size() == raw.size()) {
+				std::copy(block.begin(), block.end(), raw.begin());
+				return;
+			}
+			const auto blockFilter = static_cast<Filter>(filter);
+			const bool filtered = blockFilter == Filter::BitShuffle || (blockFilter == Filter::Shuffle && elemSize > 1);
+			Bytes decoded(filtered ? raw.size() : 0);
+			Bytes scratch;
+			if (static_cast<Codec>(codec) != Codec::LZ4 || !LZ4::decompress(block, filtered ? std::span {decoded} : raw)) {
+				valid[b] = 0;
+				return;
+			}
+			if (blockFilter == Filter::BitShuffle) {
+				bitUnshuffle(decoded, elemSize, raw.data(), scratch);
+			} else if (filtered) {
+				unshuffle(decoded, elemSize, raw.data());
+			}
+		});
+		if (std::find(valid.begin(), valid.end(), 0) != valid.end()) {
+			throwCorrupted();
+		}
+		return result;
+	}
+
+	namespace Detail {
+		std::vector<std::uint8_t> compressLZ4Block(std::span<const std::uint8_t> input, int level) {
+			Bytes result;
+			LZ4::compress(input, std::clamp(level, 1, 9), result);
+			return result;
+		}
+
+		bool decompressLZ4Block(std::span<const std::uint8_t> input, std::span<std::uint8_t> output) noexcept {
+			return LZ4::decompress(input, output);
+		}
+	}  // namespace Detail
+
+}  // namespace LLU::NA
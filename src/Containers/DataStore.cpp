@@ -26,11 +26,15 @@ namespace LLU {
 	}
 
 	Argument::TypedArgument GenericDataNode::value() const {
+		return Argument::fromMArgument(rawValue(), type());
+	}
+
+	MArgument GenericDataNode::rawValue() const {
 		MArgument m;
 		if (LibraryData::DataStoreAPI()->DataStoreNode_getData(node, &m) != 0) {
 			ErrorManager::throwException(ErrorName::DLGetNodeDataError);
 		}
-		return Argument::fromMArgument(m, type());
+		return m;
 	}
 
 	GenericDataNode::operator bool() const {
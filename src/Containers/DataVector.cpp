@@ -7,7 +7,9 @@
 
 #include "LLU/Containers/Generic/DataVector.hpp"
 
+#include <algorithm>
 #include <numeric>
+#include <utility>
 
 namespace LLU {
 
@@ -59,9 +61,26 @@ namespace LLU {
 	}
 
 	DataVector::MContainer(mint str_count, UniquePtr<const char>&& string_data, UniquePtr<mint[]>&& offsets, const Int8Array& validity) {
+		createString(str_count, string_data.release(), offsets.release(), validity);
+	}
+
+	DataVector::MContainer(std::string_view characters, std::span<const mint> offsets, const Int8Array& validity) {
+		// offsets must start at 0, never decrease and stay within characters, otherwise string accessors would read out of bounds
+		if (offsets.empty() || offsets.front() != 0 || !std::is_sorted(offsets.begin(), offsets.end()) ||
+			std::cmp_greater(offsets.back(), characters.size())) {
+			ErrorManager::throwException(ErrorName::DVConstructorType, DV::typeName(DV::Type::String));
+		}
+		auto lib_offsets = LLU::makeUnique<mint[]>(offsets.size());
+		std::copy(offsets.begin(), offsets.end(), lib_offsets.get());
+		auto lib_chars = LLU::makeUnique<char[]>(std::max(characters.size(), std::size_t {1}));
+		std::copy(characters.begin(), characters.end(), lib_chars.get());
+		createString(static_cast<mint>(offsets.size() - 1), lib_chars.release(), lib_offsets.release(), validity);
+	}
+
+	void DataVector::createString(mint str_count, const char* string_data, mint* offsets, const Int8Array& validity) {
 		const auto* api = LibraryData::TabularAPI();
 		Container result;
-		checkAPICall(api->TabularColumn_newString(str_count, string_data.release(), offsets.release(), validity.getContainer(), &result));
+		checkAPICall(api->TabularColumn_newString(str_count, string_data, offsets, validity.getContainer(), &result));
 		reset(result);
 	}
 
@@ -173,7 +192,14 @@ namespace LLU {
 		return Int8Array {validity, Ownership::Library};
 	}
 
-	DV::Data DataVector::viewData() {
+	DV::ValidityBitmap DataVector::validityBitmap() const {
+		if (missingCount() == 0) {
+			return DV::ValidityBitmap {size()};
+		}
+		return DV::ValidityBitmap {validity()};
+	}
+
+	DV::Data DataVector::viewData() const {
 		const auto* api = LibraryData::TabularAPI();
 		const auto dv_type = type();
 		switch (dv_type) {
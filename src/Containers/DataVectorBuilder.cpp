@@ -0,0 +1,90 @@
+/**
+ * @file	DataVectorBuilder.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of non-template DataVector builders.
+ */
+
+#include "LLU/Containers/DataVectorBuilder.h"
+
+namespace LLU {
+
+	DataVector BooleanColumnBuilder::finish() {
+		auto validity_array = std::exchange(validity, {}).toInt8Array();
+		auto boolean_data = values.release();
+		return DataVector {boolean_data, validity_array};
+	}
+
+	StringColumnBuilder::StringColumnBuilder() {
+		offsets.push_back(0);
+	}
+
+	StringColumnBuilder::StringColumnBuilder(mint capacity, mint char_capacity) : StringColumnBuilder() {
+		reserve(capacity, char_capacity);
+	}
+
+	void StringColumnBuilder::reserve(mint n, mint char_count) {
+		offsets.reserve(n + 1);
+		characters.reserve(char_count);
+		validity.reserve(static_cast<std::size_t>(n));
+	}
+
+	void StringColumnBuilder::append(std::string_view str) {
+		const auto str_len = static_cast<mint>(str.size());
+		if (str_len > 0) {
+			std::memcpy(characters.extend(str_len), str.data(), str.size());
+		}
+		offsets.push_back(offsets.back() + str_len);
+		validity.append(true);
+	}
+
+	void StringColumnBuilder::appendNull() {
+		offsets.push_back(offsets.back());
+		validity.append(false);
+	}
+
+	DataVector StringColumnBuilder::finish() {
+		const auto str_count = length();
+		auto validity_array = std::exchange(validity, {}).toInt8Array();
+		UniquePtr<const char> string_data {characters.release().release()};
+		auto string_offsets = offsets.release();
+		offsets.push_back(0);
+		return DataVector {str_count, std::move(string_data), std::move(string_offsets), validity_array};
+	}
+
+	BinaryColumnBuilder::BinaryColumnBuilder() {
+		offsets.push_back(0);
+	}
+
+	BinaryColumnBuilder::BinaryColumnBuilder(mint capacity, mint byte_capacity) : BinaryColumnBuilder() {
+		reserve(capacity, byte_capacity);
+	}
+
+	void BinaryColumnBuilder::reserve(mint n, mint byte_count) {
+		offsets.reserve(n + 1);
+		bytes.reserve(byte_count);
+		validity.reserve(static_cast<std::size_t>(n));
+	}
+
+	void BinaryColumnBuilder::append(std::span<const std::uint8_t> data) {
+		const auto byte_count = static_cast<mint>(data.size());
+		if (byte_count > 0) {
+			std::memcpy(bytes.extend(byte_count), data.data(), data.size());
+		}
+		offsets.push_back(offsets.back() + byte_count);
+		validity.append(true);
+	}
+
+	void BinaryColumnBuilder::appendNull() {
+		offsets.push_back(offsets.back());
+		validity.append(false);
+	}
+
+	DataVector BinaryColumnBuilder::finish() {
+		const auto elem_count = length();
+		auto validity_array = std::exchange(validity, {}).toInt8Array();
+		auto byte_offsets = offsets.release();
+		offsets.push_back(0);
+		return DataVector {bytes.release(), elem_count, std::move(byte_offsets), validity_array};
+	}
+
+}  // namespace LLU
@@ -0,0 +1,299 @@
+/**
+ * @file	DataVectorKernels.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of column operations on DataVectors.
+ */
+
+#include "LLU/Containers/DataVectorKernels.h"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+
+#include "LLU/Containers/DataVectorBuilder.h"
+
+namespace LLU::DV {
+
+	namespace Detail {
+		unsigned chunkCount(std::size_t rows, unsigned thread_count) {
+			if (thread_count == 0) {
+				thread_count = std::max(std::thread::hardware_concurrency(), 1U);
+			}
+			return static_cast<unsigned>(std::clamp<std::size_t>(rows / MinRowsPerThread, 1, thread_count));
+		}
+
+		NumericData numericData(const DataVector& dv, const std::string& operation) {
+			auto data = dv.viewData();
+			if (const auto* numeric = std::get_if<NumericData>(&data)) {
+				return *numeric;
+			}
+			if (const auto* date = std::get_if<DateData>(&data)) {
+				return date->numeric_data;
+			}
+			if (const auto* time = std::get_if<TimeData>(&data)) {
+				return time->numeric_data;
+			}
+			ErrorManager::throwException(ErrorName::DVKernelType, operation, typeName(dv.type()));
+		}
+	}  // namespace Detail
+
+	namespace {
+		void checkIndices(std::span<const mint> indices, mint length) {
+			for (auto i : indices) {
+				if (i < 0 || i >= length) {
+					ErrorManager::throwException(ErrorName::DVIndexError, i, length);
+				}
+			}
+		}
+
+		Int8Array takeValidity(const ValidityBitmap& valid, std::span<const mint> indices) {
+			if (valid.allValid()) {
+				return {};
+			}
+			ValidityBitmap result;
+			result.reserve(indices.size());
+			for (auto i : indices) {
+				result.append(valid[static_cast<std::size_t>(i)]);
+			}
+			return result.toInt8Array();
+		}
+
+		GenericNumericArray takeNumeric(const NumericData& data, std::span<const mint> indices) {
+			auto count = static_cast<mint>(indices.size());
+			GenericNumericArray result {data.type, 1, &count};
+			Detail::visitNumericType(data.type, [&]<typename T>(std::type_identity<T>) {
+				const auto* in = static_cast<const T*>(data.raw_data);
+				auto* out = static_cast<T*>(result.rawData());
+				std::transform(indices.begin(), indices.end(), out, [in](mint i) { return in[i]; });
+			});
+			return result;
+		}
+
+		/// Check if a value of type From can be converted to type To without overflow
+		template<typename To, typename From>
+		bool representable(From value) noexcept {
+			if constexpr (std::is_floating_point_v<To>) {
+				return true;
+			} else if constexpr (std::is_integral_v<From>) {
+				return std::in_range<To>(value);
+			} else {
+				// (max / 2 + 1) * 2 is max + 1, a power of two which is exactly representable in From
+				constexpr auto lower = static_cast<From>(std::numeric_limits<To>::min());
+				constexpr auto upper = static_cast<From>(std::numeric_limits<To>::max() / 2 + 1) * 2;
+				return value >= lower && value < upper;
+			}
+		}
+
+		template<typename Key, typename KeyAt>
+		void assignGroups(Grouping& grouping, const ValidityBitmap& valid, KeyAt&& keyAt) {
+			std::unordered_map<Key, mint> ids;
+			for (std::size_t i = 0; i < grouping.groups.size(); ++i) {
+				if (!valid[i]) {
+					grouping.groups[i] = -1;
+					continue;
+				}
+				auto [it, inserted] = ids.try_emplace(keyAt(i), grouping.groupCount());
+				if (inserted) {
+					grouping.firstRows.push_back(static_cast<mint>(i));
+				}
+				grouping.groups[i] = it->second;
+			}
+		}
+
+		/// Call f with a typed pointer to the elements of a column with real numeric elements. The element type is checked on the calling thread,
+		/// so \p f may distribute the work among worker threads, which must not throw LLU exceptions with parameters.
+		template<typename F>
+		void visitRealValues(const NumericData& data, const std::string& operation, F&& f) {
+			Detail::visitNumericType(data.type, [&]<typename T>(std::type_identity<T>) {
+				if constexpr (std::is_arithmetic_v<T>) {
+					f(static_cast<const T*>(data.raw_data));
+				} else {
+					ErrorManager::throwException(ErrorName::DVKernelType, operation, "Complex");
+				}
+			});
+		}
+	}  // namespace
+
+	DataVector take(const DataVector& dv, std::span<const mint> indices) {
+		checkIndices(indices, dv.length());
+		const auto valid = dv.validityBitmap();
+		const auto count = static_cast<mint>(indices.size());
+		const auto data = dv.viewData();
+		switch (dv.type()) {
+			case Type::Numeric: {
+				return DataVector {Type::Numeric, takeNumeric(std::get<NumericData>(data), indices), takeValidity(valid, indices)};
+			}
+			case Type::Date: {
+				const auto& date = std::get<DateData>(data);
+				return DataVector {takeNumeric(date.numeric_data, indices), date.granularity, date.precision, date.time_zone, takeValidity(valid, indices)};
+			}
+			case Type::Time: {
+				const auto& time = std::get<TimeData>(data);
+				return DataVector {takeNumeric(time.numeric_data, indices), time.granularity, time.precision, takeValidity(valid, indices)};
+			}
+			case Type::Boolean: {
+				const auto& booleans = std::get<Int8Array>(data);
+				BooleanColumnBuilder builder {count};
+				for (auto i : indices) {
+					valid[static_cast<std::size_t>(i)] ? builder.append(booleans[i] != 0) : builder.appendNull();
+				}
+				return builder.finish();
+			}
+			case Type::String: {
+				const auto& strings = std::get<StringData>(data);
+				mint char_count = 0;
+				for (auto i : indices) {
+					char_count += strings.offsets[i + 1] - strings.offsets[i];
+				}
+				StringColumnBuilder builder {count, char_count};
+				for (auto i : indices) {
+					if (valid[static_cast<std::size_t>(i)]) {
+						const auto begin = static_cast<std::size_t>(strings.offsets[i]);
+						builder.append(strings.characters.substr(begin, static_cast<std::size_t>(strings.offsets[i + 1]) - begin));
+					} else {
+						builder.appendNull();
+					}
+				}
+				return builder.finish();
+			}
+			case Type::Binary: {
+				const auto& binary = std::get<BinaryData>(data);
+				mint byte_count = 0;
+				for (auto i : indices) {
+					byte_count += binary.offsets[i + 1] - binary.offsets[i];
+				}
+				BinaryColumnBuilder builder {count, byte_count};
+				for (auto i : indices) {
+					if (valid[static_cast<std::size_t>(i)]) {
+						builder.append({binary.array.data() + binary.offsets[i], static_cast<std::size_t>(binary.offsets[i + 1] - binary.offsets[i])});
+					} else {
+						builder.appendNull();
+					}
+				}
+				return builder.finish();
+			}
+			case Type::FixedWidthBinary: {
+				const auto& fixed = std::get<FixedWidthBinaryData>(data);
+				const auto width = static_cast<std::size_t>(fixed.width);
+				UInt8Array result {0, MArrayDimensions {count, fixed.width}};
+				auto* out = result.data();
+				for (auto i : indices) {
+					out = std::copy_n(fixed.array.data() + static_cast<std::size_t>(i) * width, width, out);
+				}
+				return DataVector {Type::FixedWidthBinary, std::move(result), takeValidity(valid, indices)};
+			}
+		}
+		ErrorManager::throwException(ErrorName::DVKernelType, "take", typeName(dv.type()));
+	}
+
+	DataVector cast(const DataVector& dv, numericarray_data_t type) {
+		const auto source_type = dv.type();
+		if (source_type != Type::Numeric) {
+			ErrorManager::throwException(ErrorName::DVKernelType, "cast", typeName(source_type));
+		}
+		const auto data = std::get<NumericData>(dv.viewData());
+		auto validity = dv.validityBitmap();
+		auto count = static_cast<mint>(data.length);
+		GenericNumericArray result {type, 1, &count};
+		Detail::visitNumericType(data.type, [&]<typename From>(std::type_identity<From>) {
+			Detail::visitNumericType(type, [&]<typename To>(std::type_identity<To>) {
+				if constexpr (std::is_arithmetic_v<From> && std::is_arithmetic_v<To>) {
+					const auto* in = static_cast<const From*>(data.raw_data);
+					auto* out = static_cast<To*>(result.rawData());
+					for (std::size_t i = 0; i < data.length; ++i) {
+						if (validity[i] && representable<To>(in[i])) {
+							out[i] = static_cast<To>(in[i]);
+						} else {
+							out[i] = To {};
+							validity.set(i, false);
+						}
+					}
+				} else {
+					ErrorManager::throwException(ErrorName::DVKernelType, "cast", "Complex");
+				}
+			});
+		});
+		return DataVector {Type::Numeric, std::move(result), validity.toInt8Array()};
+	}
+
+	Summary summarize(const DataVector& dv, unsigned thread_count) {
+		const auto data = Detail::numericData(dv, "summarize");
+		const auto valid = dv.validityBitmap();
+		const auto chunks = Detail::chunkCount(data.length, thread_count);
+		std::vector<Summary> partial(chunks);
+		visitRealValues(data, "summarize", [&](const auto* values) {
+			Detail::forEachChunk(data.length, chunks, [&](std::size_t c, std::size_t begin, std::size_t end) {
+				auto& summary = partial[c];
+				for (auto i = begin; i < end; ++i) {
+					if (valid[i]) {
+						summary.add(static_cast<double>(values[i]));
+					}
+				}
+			});
+		});
+		Summary result;
+		for (const auto& s : partial) {
+			result.merge(s);
+		}
+		return result;
+	}
+
+	Grouping groupBy(const DataVector& keys) {
+		const auto valid = keys.validityBitmap();
+		const auto data = keys.viewData();
+		Grouping grouping;
+		grouping.groups.resize(keys.size());
+		switch (keys.type()) {
+			case Type::Numeric:
+			case Type::Date:
+			case Type::Time: {
+				const auto numeric = Detail::numericData(keys, "groupBy");
+				Detail::visitNumericType(numeric.type, [&]<typename T>(std::type_identity<T>) {
+					if constexpr (std::is_arithmetic_v<T>) {
+						const auto* values = static_cast<const T*>(numeric.raw_data);
+						assignGroups<T>(grouping, valid, [values](std::size_t i) { return values[i]; });
+					} else {
+						ErrorManager::throwException(ErrorName::DVKernelType, "groupBy", "Complex");
+					}
+				});
+				break;
+			}
+			case Type::String: {
+				const auto& strings = std::get<StringData>(data);
+				assignGroups<std::string_view>(grouping, valid, [&strings](std::size_t i) {
+					const auto begin = static_cast<std::size_t>(strings.offsets[i]);
+					return strings.characters.substr(begin, static_cast<std::size_t>(strings.offsets[i + 1]) - begin);
+				});
+				break;
+			}
+			case Type::Boolean: {
+				const auto* booleans = std::get<Int8Array>(data).data();
+				assignGroups<bool>(grouping, valid, [booleans](std::size_t i) { return booleans[i] != 0; });
+				break;
+			}
+			default: ErrorManager::throwException(ErrorName::DVKernelType, "groupBy", typeName(keys.type()));
+		}
+		return grouping;
+	}
+
+	std::vector<Summary> summarizeGroups(const Grouping& grouping, const DataVector& values) {
+		const auto rows = grouping.groups.size();
+		if (values.size() != rows) {
+			ErrorManager::throwException(ErrorName::DVLengthMismatch, static_cast<mint>(rows), values.length());
+		}
+		const auto data = Detail::numericData(values, "summarizeGroups");
+		const auto valid = values.validityBitmap();
+		std::vector<Summary> result(static_cast<std::size_t>(grouping.groupCount()));
+		visitRealValues(data, "summarizeGroups", [&](const auto* values) {
+			for (std::size_t i = 0; i < rows; ++i) {
+				if (const auto group = grouping.groups[i]; group >= 0 && valid[i]) {
+					result[static_cast<std::size_t>(group)].add(static_cast<double>(values[i]));
+				}
+			}
+		});
+		return result;
+	}
+
+}  // namespace LLU::DV
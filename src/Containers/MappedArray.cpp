@@ -0,0 +1,174 @@
+/**
+ * @file	MappedArray.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of MappedFile on POSIX systems and on Windows.
+ */
+
+#include "LLU/NoMinMaxWindows.h"
+#include "LLU/Containers/MappedArray.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "LLU/ErrorLog/ErrorManager.h"
+#include "LLU/FileUtilities.h"
+
+namespace LLU {
+
+	namespace {
+		/// Check that the requested region lies within a file of size \p fileSize and get its length
+		std::size_t checkedRegionLength(const std::string& fileName, std::size_t fileSize, std::size_t offset, std::optional<std::size_t> length) {
+			if (offset > fileSize || (length && *length > fileSize - offset)) {
+				ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, "Requested region exceeds the size of the file", fileName);
+			}
+			return length.value_or(fileSize - offset);
+		}
+
+#ifdef _WIN32
+		/// Owner of a Windows HANDLE, closes it in destructor
+		struct HandleGuard {
+			HANDLE handle;
+			~HandleGuard() {
+				if (handle != nullptr && handle != INVALID_HANDLE_VALUE) {
+					CloseHandle(handle);
+				}
+			}
+		};
+#else
+		/// Owner of a file descriptor, closes it in destructor
+		struct DescriptorGuard {
+			int fd;
+			~DescriptorGuard() {
+				if (fd >= 0) {
+					::close(fd);
+				}
+			}
+		};
+
+		int adviceFlag(MappedAccess access) noexcept {
+			switch (access) {
+				case MappedAccess::Sequential: return POSIX_MADV_SEQUENTIAL;
+				case MappedAccess::Random: return POSIX_MADV_RANDOM;
+				case MappedAccess::WillNeed: return POSIX_MADV_WILLNEED;
+				case MappedAccess::DontNeed: return POSIX_MADV_DONTNEED;
+				default: return POSIX_MADV_NORMAL;
+			}
+		}
+#endif
+	}  // namespace
+
+	MappedFile::MappedFile(const std::string& fileName, std::size_t offset, std::optional<std::size_t> length) {
+		validatePath(fileName, std::ios::in);
+#ifdef _WIN32
+		std::wstring fileNameUTF16 = fromUTF8toUTF16<wchar_t>(fileName);
+		HandleGuard file {CreateFileW(fileNameUTF16.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr)};
+		if (file.handle == INVALID_HANDLE_VALUE) {
+			ErrorManager::throwException(ErrorName::OpenFileFailed, fileName);
+		}
+		LARGE_INTEGER fileSize;
+		if (!GetFileSizeEx(file.handle, &fileSize)) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, "GetFileSizeEx failed", fileName);
+		}
+		regionLength = checkedRegionLength(fileName, static_cast<std::size_t>(fileSize.QuadPart), offset, length);
+		if (regionLength == 0) {
+			return;
+		}
+		SYSTEM_INFO info;
+		GetSystemInfo(&info);
+		const auto alignedOffset = offset - offset % info.dwAllocationGranularity;
+		mappingLength = regionLength + (offset - alignedOffset);
+		HandleGuard fileMapping {CreateFileMappingW(file.handle, nullptr, PAGE_READONLY, 0, 0, nullptr)};
+		if (fileMapping.handle == nullptr) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, "CreateFileMapping failed", fileName);
+		}
+		const auto high = static_cast<DWORD>(static_cast<std::uint64_t>(alignedOffset) >> 32U);
+		const auto low = static_cast<DWORD>(alignedOffset & 0xFFFFFFFFU);
+		// the view keeps the file mapping object alive, so both handles can be closed right away
+		mapping = MapViewOfFile(fileMapping.handle, FILE_MAP_READ, high, low, mappingLength);
+		if (mapping == nullptr) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, "MapViewOfFile failed", fileName);
+		}
+#else
+		DescriptorGuard file {::open(fileName.c_str(), O_RDONLY | O_CLOEXEC)};	  // NOLINT(cppcoreguidelines-pro-type-vararg)
+		if (file.fd < 0) {
+			ErrorManager::throwException(ErrorName::OpenFileFailed, fileName);
+		}
+		struct stat fileStat {};
+		if (::fstat(file.fd, &fileStat) != 0) {
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, std::strerror(errno), fileName);
+		}
+		regionLength = checkedRegionLength(fileName, static_cast<std::size_t>(fileStat.st_size), offset, length);
+		if (regionLength == 0) {
+			return;
+		}
+		const auto pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+		const auto alignedOffset = offset - offset % pageSize;
+		mappingLength = regionLength + (offset - alignedOffset);
+		// the mapping stays valid after the descriptor is closed
+		mapping = ::mmap(nullptr, mappingLength, PROT_READ, MAP_SHARED, file.fd, static_cast<off_t>(alignedOffset));
+		if (mapping == MAP_FAILED) {
+			mapping = nullptr;
+			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MapFileFailed, std::strerror(errno), fileName);
+		}
+#endif
+		regionBegin = static_cast<const std::byte*>(mapping) + (offset - alignedOffset);
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept
+		: mapping {std::exchange(other.mapping, nullptr)}, mappingLength {std::exchange(other.mappingLength, 0)},
+		  regionBegin {std::exchange(other.regionBegin, nullptr)}, regionLength {std::exchange(other.regionLength, 0)} {}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+		if (this != &other) {
+			unmap();
+			mapping = std::exchange(other.mapping, nullptr);
+			mappingLength = std::exchange(other.mappingLength, 0);
+			regionBegin = std::exchange(other.regionBegin, nullptr);
+			regionLength = std::exchange(other.regionLength, 0);
+		}
+		return *this;
+	}
+
+	MappedFile::~MappedFile() {
+		unmap();
+	}
+
+	void MappedFile::unmap() noexcept {
+		if (mapping) {
+#ifdef _WIN32
+			UnmapViewOfFile(mapping);
+#else
+			::munmap(mapping, mappingLength);
+#endif
+		}
+		mapping = nullptr;
+		mappingLength = 0;
+		regionBegin = nullptr;
+		regionLength = 0;
+	}
+
+	void MappedFile::advise(MappedAccess access) const noexcept {
+		if (!mapping) {
+			return;
+		}
+#ifdef _WIN32
+		// Windows only supports prefetching, other hints are ignored
+		if (access == MappedAccess::WillNeed) {
+			WIN32_MEMORY_RANGE_ENTRY range {mapping, mappingLength};
+			PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+		}
+#else
+		::posix_madvise(mapping, mappingLength, adviceFlag(access));
+#endif
+	}
+
+}  // namespace LLU
@@ -0,0 +1,174 @@
+/**
+ * @file	ValidityBitmap.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of ValidityBitmap.
+ */
+
+#include "LLU/Containers/ValidityBitmap.h"
+
+#include <algorithm>
+#include <bit>
+
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::DV {
+
+	namespace {
+		constexpr std::size_t wordCount(std::size_t bits) noexcept {
+			return (bits + ValidityBitmap::WordBits - 1) / ValidityBitmap::WordBits;
+		}
+
+		/// Word with the lowest \p n bits set, for 0 < n < 64
+		constexpr std::uint64_t lowBits(std::size_t n) noexcept {
+			return (std::uint64_t {1} << n) - 1;
+		}
+
+		void checkLengths(const ValidityBitmap& lhs, const ValidityBitmap& rhs) {
+			if (lhs.size() != rhs.size()) {
+				ErrorManager::throwException(ErrorName::DVLengthMismatch, lhs.length(), rhs.length());
+			}
+		}
+	}  // namespace
+
+	ValidityBitmap::ValidityBitmap(std::size_t length, bool valid) : len {length} {
+		if (!valid && length > 0) {
+			bits.assign(wordCount(length), 0);
+			missing = static_cast<mint>(length);
+		}
+	}
+
+	ValidityBitmap::ValidityBitmap(const Int8Array& mask) : len {static_cast<std::size_t>(mask.getFlattenedLength())} {
+		const auto* bytes = mask.data();
+		bits.assign(wordCount(len), 0);
+		for (std::size_t w = 0; w < bits.size(); ++w) {
+			const auto end = std::min(len, (w + 1) * WordBits);
+			std::uint64_t word = 0;
+			for (auto i = w * WordBits; i < end; ++i) {
+				word |= static_cast<std::uint64_t>(bytes[i] != 0) << (i % WordBits);
+			}
+			bits[w] = word;
+		}
+		normalize();
+	}
+
+	void ValidityBitmap::reserve(std::size_t n) {
+		reserved = std::max(reserved, n);
+		if (!bits.empty()) {
+			bits.reserve(wordCount(n));
+		}
+	}
+
+	void ValidityBitmap::materialize() {
+		bits.reserve(wordCount(std::max(reserved, len + 1)));
+		bits.assign(wordCount(len), ~std::uint64_t {0});
+		if (const auto tail = len % WordBits; tail != 0) {
+			bits.back() = lowBits(tail);
+		}
+	}
+
+	void ValidityBitmap::normalize() {
+		std::size_t present = 0;
+		for (auto w : bits) {
+			present += static_cast<std::size_t>(std::popcount(w));
+		}
+		missing = static_cast<mint>(len - present);
+		if (missing == 0) {
+			bits.clear();
+		}
+	}
+
+	void ValidityBitmap::append(bool valid, std::size_t count) {
+		if (count == 0) {
+			return;
+		}
+		if (valid && bits.empty()) {
+			len += count;
+			return;
+		}
+		if (bits.empty()) {
+			materialize();
+		}
+		const auto new_len = len + count;
+		bits.resize(wordCount(new_len), 0);
+		if (valid) {
+			// fill the partial first word, then whole words, then the partial last word
+			auto i = len;
+			if (const auto offset = i % WordBits; offset != 0) {
+				const auto n = std::min(WordBits - offset, count);
+				bits[i / WordBits] |= (n == WordBits ? ~std::uint64_t {0} : lowBits(n)) << offset;
+				i += n;
+			}
+			for (; i + WordBits <= new_len; i += WordBits) {
+				bits[i / WordBits] = ~std::uint64_t {0};
+			}
+			if (i < new_len) {
+				bits[i / WordBits] |= lowBits(new_len - i);
+			}
+		} else {
+			missing += static_cast<mint>(count);
+		}
+		len = new_len;
+	}
+
+	void ValidityBitmap::set(std::size_t i, bool valid) {
+		if ((*this)[i] == valid) {
+			return;
+		}
+		if (bits.empty()) {
+			materialize();
+		}
+		const auto mask = std::uint64_t {1} << (i % WordBits);
+		if (valid) {
+			bits[i / WordBits] |= mask;
+			if (--missing == 0) {
+				bits.clear();
+			}
+		} else {
+			bits[i / WordBits] &= ~mask;
+			++missing;
+		}
+	}
+
+	ValidityBitmap& ValidityBitmap::operator&=(const ValidityBitmap& other) {
+		checkLengths(*this, other);
+		if (other.allValid()) {
+			return *this;
+		}
+		if (allValid()) {
+			bits = other.bits;
+			missing = other.missing;
+			return *this;
+		}
+		std::transform(bits.begin(), bits.end(), other.bits.begin(), bits.begin(), [](auto a, auto b) { return a & b; });
+		normalize();
+		return *this;
+	}
+
+	ValidityBitmap& ValidityBitmap::operator|=(const ValidityBitmap& other) {
+		checkLengths(*this, other);
+		if (allValid()) {
+			return *this;
+		}
+		if (other.allValid()) {
+			bits.clear();
+			missing = 0;
+			return *this;
+		}
+		std::transform(bits.begin(), bits.end(), other.bits.begin(), bits.begin(), [](auto a, auto b) { return a | b; });
+		normalize();
+		return *this;
+	}
+
+	Int8Array ValidityBitmap::toInt8Array() const {
+		if (allValid()) {
+			return {};
+		}
+		Int8Array result {static_cast<std::int8_t>(0), MArrayDimensions {length()}};
+		auto* out = result.data();
+		for (std::size_t i = 0; i < len; ++i) {
+			out[i] = static_cast<std::int8_t>((bits[i / WordBits] >> (i % WordBits)) & 1U);
+		}
+		return result;
+	}
+
+}  // namespace LLU::DV
@@ -45,6 +45,7 @@ namespace LLU {
 			{ErrorName::NumericArraySizeError, "An error was caused by an incorrect NumericArray size."},
 			{ErrorName::NumericArrayIndexError, "An error was caused by attempting to access a nonexistent NumericArray element."},
 			{ErrorName::NumericArrayConversionError, "Failed to convert NumericArray from different type."},
+			{ErrorName::NumericArrayDecompressionError, "Compressed NumericArray data is corrupted or uses an unsupported format."},
 
 			// MTensor errors:
 			{ErrorName::TensorNewError, "Failed to create a new MTensor."},
@@ -107,6 +108,9 @@ namespace LLU {
 			{ErrorName::DLGetNodeDataError, "DataStoreNode_getData failed"},
 			{ErrorName::DLSharedDataStore, "Trying to create a Shared DataStore. DataStore can only be passed as Automatic or Manual."},
 			{ErrorName::DLPushBackTypeError, "Element to be added to the DataList has incorrect type"},
+			{ErrorName::DLIndexError, "Index `1` is out of range for a DataList of length `2`."},
+			{ErrorName::DLNameNotFound, "DataList does not contain a node named `1`."},
+			{ErrorName::DLRangeSizeMismatch, "Number of node names `1` does not match the number of node values `2`."},
 
 			// MArgument errors:
 			{ErrorName::ArgumentCreateNull, "Trying to create PrimitiveWrapper object from nullptr"},
@@ -124,11 +128,24 @@ namespace LLU {
 			{ErrorName::PathNotValidated, "File path `path` could not be validated under desired open mode."},
 			{ErrorName::InvalidOpenMode, "Specified open mode is invalid."},
 			{ErrorName::OpenFileFailed,	"Could not open file `f`."},
+			{ErrorName::MapFileFailed, "Could not map file `f` into memory."},
+			{ErrorName::FileReadFailed, "Could not read from file `f`."},
+			{ErrorName::FileWriteFailed, "Could not write to file `f`."},
+			{ErrorName::InvalidUTFSequence, "Invalid `1` sequence at position `2`."},
+			{ErrorName::UTFBufferTooSmall, "Output buffer of size `1` is too small for the converted string."},
+			{ErrorName::InvalidSnapshot, "File `1` is not a valid snapshot."},
+			{ErrorName::SnapshotEntryNotFound, "Snapshot does not contain an entry named `1`."},
+			{ErrorName::SnapshotEntryType, "Snapshot entry `1` is not an array of the requested type."},
+			{ErrorName::SnapshotEntryCompressed, "Snapshot entry `1` is compressed and cannot be mapped into memory."},
 
 				// TabularColumn errors:
 			{ErrorName::DVShared, "Trying to create a Shared TabularColumn. TabularColumn can only be passed as Automatic or Manual."},
 			{ErrorName::DVAPIError, "TabularColumn LibraryLink API returned error `1`."},
 			{ErrorName::DVConstructorType, "TabularColumn type `1` passed to the constructor does not match other arguments."},
+			{ErrorName::DVIndexError, "Index `1` is out of range for a TabularColumn of length `2`."},
+			{ErrorName::DVKernelType, "Operation `1` is not supported for TabularColumn of type `2`."},
+			{ErrorName::DVLengthMismatch, "TabularColumn lengths `1` and `2` do not match."},
+			{ErrorName::DVDictionaryFull, "Dictionary-encoded column cannot hold more than `1` distinct values."},
 
 			// BitVector errors:
 			{ErrorName::BitVectorNew, "Could not create a new BitVector."},
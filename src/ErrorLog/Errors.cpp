@@ -37,6 +37,7 @@ namespace LLU::ErrorName {
 	LLU_DEFINE_ERROR_NAME(NumericArraySizeError);
 	LLU_DEFINE_ERROR_NAME(NumericArrayIndexError);
 	LLU_DEFINE_ERROR_NAME(NumericArrayConversionError);
+	LLU_DEFINE_ERROR_NAME(NumericArrayDecompressionError);
 
 	LLU_DEFINE_ERROR_NAME(TensorNewError);
 	LLU_DEFINE_ERROR_NAME(TensorCloneError);
@@ -93,6 +94,9 @@ namespace LLU::ErrorName {
 	LLU_DEFINE_ERROR_NAME(DLGetNodeDataError);
 	LLU_DEFINE_ERROR_NAME(DLSharedDataStore);
 	LLU_DEFINE_ERROR_NAME(DLPushBackTypeError);
+	LLU_DEFINE_ERROR_NAME(DLIndexError);
+	LLU_DEFINE_ERROR_NAME(DLNameNotFound);
+	LLU_DEFINE_ERROR_NAME(DLRangeSizeMismatch);
 
 	LLU_DEFINE_ERROR_NAME(ArgumentCreateNull);
 	LLU_DEFINE_ERROR_NAME(ArgumentAddNodeMArgument);
@@ -106,10 +110,23 @@ namespace LLU::ErrorName {
 	LLU_DEFINE_ERROR_NAME(PathNotValidated);
 	LLU_DEFINE_ERROR_NAME(InvalidOpenMode);
 	LLU_DEFINE_ERROR_NAME(OpenFileFailed);
+	LLU_DEFINE_ERROR_NAME(MapFileFailed);
+	LLU_DEFINE_ERROR_NAME(FileReadFailed);
+	LLU_DEFINE_ERROR_NAME(FileWriteFailed);
+	LLU_DEFINE_ERROR_NAME(InvalidUTFSequence);
+	LLU_DEFINE_ERROR_NAME(UTFBufferTooSmall);
+	LLU_DEFINE_ERROR_NAME(InvalidSnapshot);
+	LLU_DEFINE_ERROR_NAME(SnapshotEntryNotFound);
+	LLU_DEFINE_ERROR_NAME(SnapshotEntryType);
+	LLU_DEFINE_ERROR_NAME(SnapshotEntryCompressed);
 
 	LLU_DEFINE_ERROR_NAME(DVShared);
 	LLU_DEFINE_ERROR_NAME(DVAPIError);
 	LLU_DEFINE_ERROR_NAME(DVConstructorType);
+	LLU_DEFINE_ERROR_NAME(DVIndexError);
+	LLU_DEFINE_ERROR_NAME(DVKernelType);
+	LLU_DEFINE_ERROR_NAME(DVLengthMismatch);
+	LLU_DEFINE_ERROR_NAME(DVDictionaryFull);
 
 	LLU_DEFINE_ERROR_NAME(BitVectorNew);
 	LLU_DEFINE_ERROR_NAME(BitVectorClone);
@@ -29,6 +29,21 @@ namespace LLU {
 		LibraryData::DataStoreAPI()->DataStore_##DSAdd(ds, val);                                                           \
 	}                                                                                                                      \
 	template<>                                                                                                             \
+	void PrimitiveWrapper<MArgumentType::ArgType>::addDataStoreNodes(DataStore ds, std::span<const value_type> vals) {     \
+		auto* addNode = LibraryData::DataStoreAPI()->DataStore_##DSAdd;                                                    \
+		for (const auto& val : vals) {                                                                                     \
+			addNode(ds, val);                                                                                              \
+		}                                                                                                                  \
+	}                                                                                                                      \
+	template<>                                                                                                             \
+	void PrimitiveWrapper<MArgumentType::ArgType>::addDataStoreNodes(DataStore ds, std::span<const std::string_view> names,\
+																	 std::span<const value_type> vals) {                  \
+		auto* addNode = LibraryData::DataStoreAPI()->DataStore_##DSAddNamed;                                               \
+		for (std::size_t i = 0; i < vals.size(); ++i) {                                                                    \
+			addNode(ds, const_cast<char*>(names[i].data()), vals[i]);                                                      \
+		}                                                                                                                  \
+	}                                                                                                                      \
+	template<>                                                                                                             \
 	auto PrimitiveWrapper<MArgumentType::ArgType>::getAddress() const->value_type* {                                       \
 		return MArgGetPrefix##ArgType##Address(arg);                                                                       \
 	}                                                                                                                      \
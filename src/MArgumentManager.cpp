@@ -18,17 +18,31 @@ namespace LLU {
 
 	/* Static data members */
 
-	std::string MArgumentManager::stringResultBuffer;
+	thread_local std::string MArgumentManager::stringResultBuffer;
 
 	/* Constructors */
 
-	MArgumentManager::MArgumentManager(mint Argc, MArgument* Args, MArgument& Res) : argc(Argc), args(Args), res(Res) {
-		initStringArgs();
-	}
+	MArgumentManager::MArgumentManager(mint Argc, MArgument* Args, MArgument& Res) : argc(Argc), args(Args), res(Res) {}
 
 	MArgumentManager::MArgumentManager(WolframLibraryData ld, mint Argc, MArgument* Args, MArgument& Res) : argc(Argc), args(Args), res(Res) {
 		LibraryData::setLibraryData(ld);
-		initStringArgs();
+	}
+
+	MArgumentManager::MArgumentManager(MArgumentManager&& other) noexcept
+		: argc(other.argc), args(other.args), res(other.res), stringArgs(std::exchange(other.stringArgs, {})),
+		  moreStringArgs(std::move(other.moreStringArgs)) {}
+
+	MArgumentManager::~MArgumentManager() {
+		const auto disown = [](char* str) {
+			if (str != nullptr) {
+				LibraryData::API()->UTF8String_disown(str);
+			}
+		};
+		const auto inlineCount = std::min(static_cast<size_type>(argc), InlineStringArgCount);
+		std::for_each(stringArgs.begin(), stringArgs.begin() + inlineCount, disown);
+		if (moreStringArgs) {
+			std::for_each(moreStringArgs.get(), moreStringArgs.get() + (static_cast<size_type>(argc) - InlineStringArgCount), disown);
+		}
 	}
 
 	/* Other member functions */
@@ -41,21 +55,40 @@ namespace LLU {
 		return static_cast<double>(MArgument_getReal(getArgs(index)));
 	}
 
-	void MArgumentManager::acquireUTF8String(size_type index) const {
-		if (!stringArgs.at(index)) {
-			char* strArg = MArgument_getUTF8String(getArgs(index));
-			stringArgs[index].reset(strArg);
+	char* MArgumentManager::acquireUTF8String(size_type index) const {
+		const auto arg = getArgs(index);
+		auto& str = stringArg(index);
+		if (str == nullptr) {
+			str = MArgument_getUTF8String(arg);
+		}
+		return str;
+	}
+
+	char*& MArgumentManager::stringArg(size_type index) const {
+		if (index < InlineStringArgCount) {
+			return stringArgs[index];
+		}
+		if (!moreStringArgs) {
+			moreStringArgs = std::make_unique<char*[]>(static_cast<size_type>(argc) - InlineStringArgCount);
 		}
+		return moreStringArgs[index - InlineStringArgCount];
 	}
 
 	char* MArgumentManager::getCString(size_type index) const {
-		acquireUTF8String(index);
-		return stringArgs[index].get();
+		return acquireUTF8String(index);
 	}
 
 	std::string MArgumentManager::getString(size_type index) const {
-		acquireUTF8String(index);
-		return stringArgs[index].get();
+		return acquireUTF8String(index);
+	}
+
+	std::string_view MArgumentManager::getStringView(size_type index) const {
+		return acquireUTF8String(index);
+	}
+
+	std::span<const std::byte> MArgumentManager::getBytes(size_type index) const {
+		const auto str = getStringView(index);
+		return std::as_bytes(std::span {str});
 	}
 
 	namespace {
@@ -66,8 +99,7 @@ namespace LLU {
 	}
 
 	void MArgumentManager::setString(const std::string& str) {
-		stringResultBuffer = str;
-		setStringAsMArgument(res, stringResultBuffer);
+		setString(std::string_view {str});
 	}
 
 	void MArgumentManager::setString(std::string&& str) {
@@ -76,7 +108,16 @@ namespace LLU {
 	}
 
 	void MArgumentManager::setString(const char* str) {
-		stringResultBuffer = str;
+		setString(std::string_view {str});
+	}
+
+	void MArgumentManager::setString(std::string_view str) {
+		if (str.size() > stringResultBuffer.capacity()) {
+			// the old contents are not needed, so they are dropped before growing to avoid copying them
+			stringResultBuffer.clear();
+			stringResultBuffer.reserve((std::max)(str.size(), 2 * stringResultBuffer.capacity()));
+		}
+		stringResultBuffer.assign(str);
 		setStringAsMArgument(res, stringResultBuffer);
 	}
 
@@ -181,13 +222,6 @@ namespace LLU {
 		return args[index];
 	}
 
-	void MArgumentManager::initStringArgs() {
-		stringArgs.reserve(argc);
-		for (int i = 0; i < argc; ++i) {
-			stringArgs.emplace_back(nullptr, LibraryData::API()->UTF8String_disown);
-		}
-	}
-
 	ProgressMonitor MArgumentManager::getProgressMonitor(double step) const {
 		if (argc < 1) {
 			ErrorManager::throwExceptionWithDebugInfo(ErrorName::MArgumentIndexError, "Index too small when accessing ProgressMonitor.");
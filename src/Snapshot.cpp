@@ -0,0 +1,892 @@
+/**
+ * @file	Snapshot.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of snapshot Writer and Reader.
+ */
+
+#include "LLU/Snapshot.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+#include "LLU/Containers/DataVectorKernels.h"
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU::Snapshot {
+
+	namespace {
+		/// Layout of the header at the beginning of a snapshot file
+		struct Header {
+			std::array<char, 8> magic;
+			std::uint32_t version;
+			std::uint32_t byteOrderMark;
+			std::uint32_t mintSize;
+			std::array<std::uint32_t, 11> reserved;
+		};
+		static_assert(sizeof(Header) == PayloadAlignment);
+
+		/// Layout of the footer at the end of a snapshot file, after the index
+		struct Footer {
+			std::uint64_t indexOffset;
+			std::uint64_t indexSize;
+			std::uint64_t entryCount;
+			std::array<char, 8> magic;
+		};
+		static_assert(sizeof(Footer) == 32);
+
+		constexpr std::array<char, 8> Magic {'L', 'L', 'U', 'S', 'N', 'A', 'P', '\0'};
+		constexpr std::uint32_t ByteOrderMark = 0x01020304;
+
+		[[noreturn]] void throwInvalid(const std::string& fileName) {
+			ErrorManager::throwException(ErrorName::InvalidSnapshot, fileName);
+		}
+
+		std::size_t elementSize(numericarray_data_t type) {
+			return DV::Detail::visitNumericType(type, []<typename T>(std::type_identity<T>) { return sizeof(T); });
+		}
+
+		/// Get the NumericArray type with the same element representation as given Tensor type
+		numericarray_data_t tensorElementType(mint type) {
+			switch (type) {
+				case MType_Integer: return NumericArrayType<mint>;
+				case MType_Real: return NumericArrayType<double>;
+				case MType_Complex: return NumericArrayType<std::complex<double>>;
+				default: ErrorManager::throwException(ErrorName::TensorTypeError);
+			}
+		}
+
+		/// Get the NumericArray type with the same element representation as given Image type
+		numericarray_data_t imageElementType(imagedata_t type) {
+			switch (type) {
+				case MImage_Type_Bit: return NumericArrayType<std::int8_t>;
+				case MImage_Type_Bit8: return NumericArrayType<std::uint8_t>;
+				case MImage_Type_Bit16: return NumericArrayType<std::uint16_t>;
+				case MImage_Type_Real32: return NumericArrayType<float>;
+				case MImage_Type_Real: return NumericArrayType<double>;
+				default: ErrorManager::throwException(ErrorName::ImageTypeError);
+			}
+		}
+
+		std::span<const std::byte> bytesOf(const void* data, std::size_t count) {
+			return {static_cast<const std::byte*>(data), count};
+		}
+
+		std::span<const std::byte> tensorBytes(const GenericTensor& t) {
+			return bytesOf(t.rawData(), static_cast<std::size_t>(t.getFlattenedLength()) * elementSize(tensorElementType(t.type())));
+		}
+
+		std::span<const std::uint8_t> asUnsigned(std::span<const std::byte> bytes) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): the codec works on raw bytes
+			return {reinterpret_cast<const std::uint8_t*>(bytes.data()), bytes.size()};
+		}
+
+		/// Compress a payload section with LZ4 in blocks of CompressionBlockSize bytes. The result holds the sizes of compressed blocks followed by
+		/// the blocks, a block which does not get smaller is stored unchanged and recognized by its size.
+		std::vector<std::uint8_t> compressSection(std::span<const std::byte> payload, int level) {
+			const auto bytes = asUnsigned(payload);
+			const auto blockCount = (bytes.size() + CompressionBlockSize - 1) / CompressionBlockSize;
+			std::vector<std::uint8_t> result(blockCount * sizeof(std::uint64_t));
+			for (std::size_t b = 0; b < blockCount; ++b) {
+				const auto raw = bytes.subspan(b * CompressionBlockSize, std::min(CompressionBlockSize, bytes.size() - b * CompressionBlockSize));
+				auto block = NA::Detail::compressLZ4Block(raw, level);
+				if (block.size() >= raw.size()) {
+					block.assign(raw.begin(), raw.end());
+				}
+				const std::uint64_t blockSize = block.size();
+				std::memcpy(result.data() + b * sizeof(blockSize), &blockSize, sizeof(blockSize));
+				result.insert(result.end(), block.begin(), block.end());
+			}
+			return result;
+		}
+
+		/// Location of a payload section, as described in the index
+		struct SectionLocation {
+			std::uint64_t offset;
+			std::uint64_t size;
+			NA::Codec codec;
+			/// Size of the section after decompression
+			std::uint64_t rawSize;
+		};
+
+		/// Sequential reader of a part of the snapshot index
+		class Cursor {
+		public:
+			Cursor(std::span<const std::byte> bytes, std::span<const std::byte> payloads, const std::string& fileName)
+				: bytes {bytes}, payloads {payloads}, fileName {fileName} {}
+
+			template<typename T>
+			T get() {
+				T result;
+				std::memcpy(&result, take(sizeof(T)).data(), sizeof(T));
+				return result;
+			}
+
+			/// Read a non-negative count
+			std::size_t count() {
+				auto n = get<mint>();
+				if (n < 0) {
+					throwInvalid(fileName);
+				}
+				return static_cast<std::size_t>(n);
+			}
+
+			/// Read a string, the returned view is followed by a null character
+			std::string_view string() {
+				const auto length = get<std::uint32_t>();
+				const auto chars = take(std::size_t {length} + 1);
+				if (chars.back() != std::byte {0}) {
+					throwInvalid(fileName);
+				}
+				return {reinterpret_cast<const char*>(chars.data()), length};	 // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast): raw bytes of a string
+			}
+
+			std::vector<mint> dimensions() {
+				const auto rank = count();
+				if (rank > bytes.size() / sizeof(mint)) {
+					throwInvalid(fileName);
+				}
+				std::vector<mint> dims(rank);
+				for (auto& d : dims) {
+					d = get<mint>();
+				}
+				return dims;
+			}
+
+			/// Read the location of a payload section, checking that a non-empty section lies within the payload area
+			SectionLocation location() {
+				SectionLocation result {};
+				result.offset = get<std::uint64_t>();
+				result.size = get<std::uint64_t>();
+				const auto codec = get<std::uint8_t>();
+				if (codec > static_cast<std::uint8_t>(NA::Codec::LZ4)) {
+					throwInvalid(fileName);
+				}
+				result.codec = static_cast<NA::Codec>(codec);
+				result.rawSize = (result.codec == NA::Codec::None) ? result.size : get<std::uint64_t>();
+				if (result.codec != NA::Codec::None && (result.size == 0 || result.rawSize == 0)) {
+					throwInvalid(fileName);
+				}
+				if (result.size > 0 &&
+					(result.offset % PayloadAlignment != 0 || result.offset > payloads.size() || result.size > payloads.size() - result.offset)) {
+					throwInvalid(fileName);
+				}
+				return result;
+			}
+
+			/// Read the location of a payload section and get its bytes, compressed sections are decompressed into a buffer owned by the Cursor
+			std::span<const std::byte> section() {
+				const auto s = location();
+				if (s.size == 0) {
+					return {};
+				}
+				const auto stored = payloads.subspan(s.offset, s.size);
+				if (s.codec == NA::Codec::None) {
+					return stored;
+				}
+				return decompressed.emplace_back(decompress(stored, s.rawSize));
+			}
+
+			/// Read a section which must have exactly \p size bytes
+			std::span<const std::byte> section(std::size_t size) {
+				auto result = section();
+				if (result.size() != size) {
+					throwInvalid(fileName);
+				}
+				return result;
+			}
+
+			/// Read a section holding a string, which in the file is followed by a null character
+			std::string_view stringSection() {
+				const auto s = location();
+				if (s.size == 0) {
+					return {""};
+				}
+				if (s.codec != NA::Codec::None || s.size >= payloads.size() - s.offset || payloads[s.offset + s.size] != std::byte {0}) {
+					throwInvalid(fileName);
+				}
+				// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): raw bytes of a string
+				return {reinterpret_cast<const char*>(payloads.data() + s.offset), static_cast<std::size_t>(s.size)};
+			}
+
+			/// Get the next \p size bytes without interpreting them
+			std::span<const std::byte> take(std::size_t size) {
+				if (size > bytes.size()) {
+					throwInvalid(fileName);
+				}
+				auto result = bytes.first(size);
+				bytes = bytes.subspan(size);
+				return result;
+			}
+
+			/// Split off the next \p size bytes as a separate Cursor
+			Cursor sub(std::size_t size) {
+				return {take(size), payloads, fileName};
+			}
+
+			[[nodiscard]] bool atEnd() const noexcept {
+				return bytes.empty();
+			}
+
+			[[nodiscard]] const std::string& file() const noexcept {
+				return fileName;
+			}
+
+		private:
+			/// Decompress a section written by compressSection()
+			std::vector<std::byte> decompress(std::span<const std::byte> stored, std::uint64_t rawSize) {
+				const auto blockCount = (rawSize + CompressionBlockSize - 1) / CompressionBlockSize;
+				if (blockCount > stored.size() / sizeof(std::uint64_t)) {
+					throwInvalid(fileName);
+				}
+				std::vector<std::byte> result(static_cast<std::size_t>(rawSize));
+				auto blocks = asUnsigned(stored.subspan(static_cast<std::size_t>(blockCount) * sizeof(std::uint64_t)));
+				for (std::size_t b = 0; b < blockCount; ++b) {
+					std::uint64_t blockSize = 0;
+					std::memcpy(&blockSize, stored.data() + b * sizeof(blockSize), sizeof(blockSize));
+					if (blockSize > blocks.size()) {
+						throwInvalid(fileName);
+					}
+					const auto block = blocks.first(static_cast<std::size_t>(blockSize));
+					blocks = blocks.subspan(block.size());
+					const auto rawBlockSize = std::min<std::size_t>(CompressionBlockSize, result.size() - b * CompressionBlockSize);
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): the codec works on raw bytes
+					const std::span raw {reinterpret_cast<std::uint8_t*>(result.data()) + b * CompressionBlockSize, rawBlockSize};
+					if (block.size() == raw.size()) {
+						std::copy(block.begin(), block.end(), raw.begin());
+					} else if (!NA::Detail::decompressLZ4Block(block, raw)) {
+						throwInvalid(fileName);
+					}
+				}
+				if (!blocks.empty()) {
+					throwInvalid(fileName);
+				}
+				return result;
+			}
+
+			std::span<const std::byte> bytes;
+			std::span<const std::byte> payloads;
+			const std::string& fileName;
+
+			/// Sections decompressed by this Cursor, they are only needed until the value that uses them is read
+			std::vector<std::vector<std::byte>> decompressed;
+		};
+
+		/// Get the number of elements of an array with given dimensions, or throw if the dimensions are invalid
+		std::size_t flatCount(const std::vector<mint>& dims, const std::string& fileName) {
+			std::size_t result = 1;
+			for (auto d : dims) {
+				if (d < 0 || (d > 0 && result > std::numeric_limits<std::size_t>::max() / static_cast<std::size_t>(d))) {
+					throwInvalid(fileName);
+				}
+				result *= static_cast<std::size_t>(d);
+			}
+			return result;
+		}
+
+		std::size_t byteCount(std::size_t count, std::size_t elemSize, const std::string& fileName) {
+			if (elemSize > 0 && count > std::numeric_limits<std::size_t>::max() / elemSize) {
+				throwInvalid(fileName);
+			}
+			return count * elemSize;
+		}
+
+		template<typename T>
+		std::span<const T> viewAs(std::span<const std::byte> bytes) {
+			// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): sections are aligned to PayloadAlignment and hold values of type T
+			return {reinterpret_cast<const T*>(bytes.data()), bytes.size() / sizeof(T)};
+		}
+
+		void copyInto(void* destination, std::span<const std::byte> source) {
+			if (!source.empty()) {
+				std::memcpy(destination, source.data(), source.size());
+			}
+		}
+
+		Argument::TypedArgument readValue(Cursor& in, MArgumentType kind);
+
+		GenericTensor readTensor(Cursor& in) {
+			const auto type = in.get<mint>();
+			const auto dims = in.dimensions();
+			GenericTensor result {type, static_cast<mint>(dims.size()), dims.data()};
+			copyInto(result.rawData(), in.section(byteCount(flatCount(dims, in.file()), elementSize(tensorElementType(type)), in.file())));
+			return result;
+		}
+
+		GenericNumericArray readNumericArray(Cursor& in) {
+			const auto type = static_cast<numericarray_data_t>(in.get<std::uint32_t>());
+			const auto dims = in.dimensions();
+			GenericNumericArray result {type, static_cast<mint>(dims.size()), dims.data()};
+			copyInto(result.rawData(), in.section(byteCount(flatCount(dims, in.file()), elementSize(type), in.file())));
+			return result;
+		}
+
+		GenericImage readImage(Cursor& in) {
+			const auto slices = in.get<mint>();
+			const auto width = in.get<mint>();
+			const auto height = in.get<mint>();
+			const auto channels = in.get<mint>();
+			const auto type = static_cast<imagedata_t>(in.get<std::uint32_t>());
+			const auto colorspace = static_cast<colorspace_t>(in.get<std::uint32_t>());
+			const auto interleaved = static_cast<mbool>(in.get<std::uint8_t>());
+			GenericImage result {slices, width, height, channels, type, colorspace, interleaved};
+			const auto size = static_cast<std::size_t>(result.getFlattenedLength()) * elementSize(imageElementType(type));
+			copyInto(result.rawData(), in.section(size));
+			return result;
+		}
+
+		GenericSparseArray readSparseArray(Cursor& in) {
+			const auto type = in.get<mint>();
+			const auto dims = in.dimensions();
+			const auto rank = dims.size();
+			const auto nnz = in.count();
+			const auto width = in.count();
+			const auto rowPointerCount = in.count();
+			const auto rowPointers = viewAs<mint>(in.section(byteCount(rowPointerCount, sizeof(mint), in.file())));
+			const auto columnIndices = viewAs<mint>(in.section(byteCount(byteCount(nnz, width, in.file()), sizeof(mint), in.file())));
+
+			// Row pointers and column indices are converted to explicit positions, which is the form accepted by LibraryLink.
+			// Column indices of a vector already are the positions, otherwise each position starts with the 1-based row index.
+			const auto leading = rank - width;
+			if (width > rank || leading > 1 || (leading == 1 && rowPointerCount != static_cast<std::size_t>(dims[0]) + 1)) {
+				throwInvalid(in.file());
+			}
+			if (leading == 1 && (rowPointers.front() != 0 || rowPointers.back() != static_cast<mint>(nnz) ||
+								 !std::is_sorted(rowPointers.begin(), rowPointers.end()))) {
+				throwInvalid(in.file());
+			}
+			const auto positionRank = static_cast<mint>(rank);
+			const std::array positionDims {static_cast<mint>(nnz), positionRank};
+			GenericTensor positions {MType_Integer, 2, positionDims.data()};
+			auto* pos = static_cast<mint*>(positions.rawData());
+			if (leading == 0) {
+				std::copy(columnIndices.begin(), columnIndices.end(), pos);
+			} else {
+				auto column = columnIndices.begin();
+				for (std::size_t row = 0; row + 1 < rowPointerCount; ++row) {
+					for (auto k = rowPointers[row]; k < rowPointers[row + 1]; ++k) {
+						*pos++ = static_cast<mint>(row) + 1;
+						pos = std::copy_n(column, width, pos);
+						column += static_cast<std::ptrdiff_t>(width);
+					}
+				}
+			}
+
+			const auto elemSize = elementSize(tensorElementType(type));
+			const auto nnzCount = static_cast<mint>(nnz);
+			GenericTensor values {type, 1, &nnzCount};
+			copyInto(values.rawData(), in.section(byteCount(nnz, elemSize, in.file())));
+			GenericTensor implicitValue {type, 0, nullptr};
+			copyInto(implicitValue.rawData(), in.section(elemSize));
+			GenericTensor dimensions {MType_Integer, 1, &positionRank};
+			std::copy(dims.begin(), dims.end(), static_cast<mint*>(dimensions.rawData()));
+			return {positions, values, dimensions, implicitValue};
+		}
+
+		Int8Array readValidity(Cursor& in, mint length) {
+			auto bytes = in.section();
+			if (bytes.empty()) {
+				return {};
+			}
+			if (bytes.size() != static_cast<std::size_t>(length)) {
+				throwInvalid(in.file());
+			}
+			Int8Array validity {0, MArrayDimensions {length}};
+			copyInto(validity.data(), bytes);
+			return validity;
+		}
+
+		GenericNumericArray readColumnData(Cursor& in, numericarray_data_t type, mint length) {
+			GenericNumericArray result {type, 1, &length};
+			copyInto(result.rawData(), in.section(byteCount(static_cast<std::size_t>(length), elementSize(type), in.file())));
+			return result;
+		}
+
+		DataVector readDataVector(Cursor& in) {
+			const auto type = static_cast<DV::Type>(in.get<std::uint8_t>());
+			const auto length = static_cast<mint>(in.count());
+			const auto validity = readValidity(in, length);
+			const auto offsetBytes = byteCount(static_cast<std::size_t>(length) + 1, sizeof(mint), in.file());
+			switch (type) {
+				case DV::Type::Numeric: {
+					const auto dataType = static_cast<numericarray_data_t>(in.get<std::uint32_t>());
+					return {DV::Type::Numeric, readColumnData(in, dataType, length), validity};
+				}
+				case DV::Type::String: {
+					const auto offsets = viewAs<mint>(in.section(offsetBytes));
+					const auto chars = in.section();
+					if (offsets.front() != 0 || offsets.back() != static_cast<mint>(chars.size()) || !std::is_sorted(offsets.begin(), offsets.end())) {
+						throwInvalid(in.file());
+					}
+					// NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast): raw bytes of a string
+					return {std::string_view {reinterpret_cast<const char*>(chars.data()), chars.size()}, offsets, validity};
+				}
+				case DV::Type::Boolean: {
+					Int8Array booleans {0, MArrayDimensions {length}};
+					copyInto(booleans.data(), in.section(static_cast<std::size_t>(length)));
+					return {booleans, validity};
+				}
+				case DV::Type::Binary: {
+					const auto offsets = viewAs<mint>(in.section(offsetBytes));
+					const auto bytes = in.section();
+					if (offsets.front() != 0 || offsets.back() != static_cast<mint>(bytes.size()) || !std::is_sorted(offsets.begin(), offsets.end())) {
+						throwInvalid(in.file());
+					}
+					UInt8Array array {0, MArrayDimensions {static_cast<mint>(bytes.size())}};
+					copyInto(array.data(), bytes);
+					auto libraryOffsets = makeUnique<mint[]>(offsets.size());
+					std::copy(offsets.begin(), offsets.end(), libraryOffsets.get());
+					return {std::move(array), length, std::move(libraryOffsets), validity};
+				}
+				case DV::Type::FixedWidthBinary: {
+					const auto width = static_cast<mint>(in.count());
+					UInt8Array array {0, MArrayDimensions {length, width}};
+					copyInto(array.data(), in.section(byteCount(static_cast<std::size_t>(length), static_cast<std::size_t>(width), in.file())));
+					return {DV::Type::FixedWidthBinary, std::move(array), validity};
+				}
+				case DV::Type::Date: {
+					const auto dataType = static_cast<numericarray_data_t>(in.get<std::uint32_t>());
+					const auto granularity = in.get<mint>();
+					const auto precision = in.get<mint>();
+					const std::string timeZone {in.string()};
+					return {readColumnData(in, dataType, length), granularity, precision, timeZone, validity};
+				}
+				case DV::Type::Time: {
+					const auto dataType = static_cast<numericarray_data_t>(in.get<std::uint32_t>());
+					const auto granularity = in.get<mint>();
+					const auto precision = in.get<mint>();
+					return {readColumnData(in, dataType, length), granularity, precision, validity};
+				}
+			}
+			throwInvalid(in.file());
+		}
+
+		/// Read a named node (name, type and the size of its description) and call \p f with the name and the value
+		template<typename F>
+		void readNode(Cursor& in, F&& f) {
+			const auto name = in.string();
+			const auto kind = static_cast<MArgumentType>(in.get<std::uint8_t>());
+			auto description = in.sub(static_cast<std::size_t>(in.get<std::uint64_t>()));
+			std::forward<F>(f)(name, readValue(description, kind));
+		}
+
+		GenericDataList readDataList(Cursor& in) {
+			const auto count = in.count();
+			GenericDataList result;
+			for (std::size_t i = 0; i < count; ++i) {
+				readNode(in, [&](std::string_view name, const Argument::TypedArgument& value) { result.push_back(name, value); });
+			}
+			return result;
+		}
+
+		Argument::TypedArgument readValue(Cursor& in, MArgumentType kind) {
+			switch (kind) {
+				case MArgumentType::Boolean: return in.get<std::uint8_t>() != 0;
+				case MArgumentType::Integer: return in.get<mint>();
+				case MArgumentType::Real: return in.get<double>();
+				case MArgumentType::Complex: {
+					const auto re = in.get<double>();
+					return std::complex<double> {re, in.get<double>()};
+				}
+				case MArgumentType::Tensor: return readTensor(in);
+				case MArgumentType::SparseArray: return readSparseArray(in);
+				case MArgumentType::NumericArray: return readNumericArray(in);
+				case MArgumentType::Image: return readImage(in);
+				case MArgumentType::UTF8String: return in.stringSection();
+				case MArgumentType::DataStore: return readDataList(in);
+				case MArgumentType::TabularColumn: return readDataVector(in);
+				default: throwInvalid(in.file());
+			}
+		}
+	}  // namespace
+
+	/* Writer */
+
+	Writer::Writer(const std::string& fileName, NA::Codec codec, int level)
+		: fileName {fileName}, file {openFile(fileName, std::ios::out | std::ios::trunc | std::ios::binary)}, codec {codec}, level {level} {
+		Header header {};
+		header.magic = Magic;
+		header.version = FormatVersion;
+		header.byteOrderMark = ByteOrderMark;
+		header.mintSize = sizeof(mint);
+		writeBytes(&header, sizeof(header));
+	}
+
+	void Writer::add(std::string_view name, const Argument::TypedArgument& value) {
+		writeNode(name, static_cast<MArgumentType>(value.index()), value);
+		++entryCount;
+	}
+
+	void Writer::add(std::string_view name, const GenericTensor& value) {
+		writeNode(name, MArgumentType::Tensor, value);
+		++entryCount;
+	}
+
+	void Writer::add(std::string_view name, const GenericNumericArray& value) {
+		writeNode(name, MArgumentType::NumericArray, value);
+		++entryCount;
+	}
+
+	void Writer::add(std::string_view name, const GenericImage& value) {
+		writeNode(name, MArgumentType::Image, value);
+		++entryCount;
+	}
+
+	void Writer::add(std::string_view name, const GenericSparseArray& value) {
+		writeNode(name, MArgumentType::SparseArray, value);
+		++entryCount;
+	}
+
+	void Writer::add(std::string_view name, const DataVector& value) {
+		writeNode(name, MArgumentType::TabularColumn, value);
+		++entryCount;
+	}
+
+	void Writer::add(std::string_view name, const GenericDataList& value) {
+		writeNode(name, MArgumentType::DataStore, value);
+		++entryCount;
+	}
+
+	void Writer::addAll(const GenericDataList& list) {
+		for (auto node : list) {
+			add(node.name(), node.value());
+		}
+	}
+
+	void Writer::finish() {
+		Footer footer {};
+		footer.indexOffset = position;
+		footer.indexSize = index.size();
+		footer.entryCount = entryCount;
+		footer.magic = Magic;
+		writeBytes(index.data(), index.size());
+		writeBytes(&footer, sizeof(footer));
+		if (std::fclose(file.release()) != 0) {
+			ErrorManager::throwException(ErrorName::FileWriteFailed, fileName);
+		}
+		index.clear();
+	}
+
+	template<typename T>
+	void Writer::writeNode(std::string_view name, MArgumentType kind, const T& value) {
+		if (!file) {
+			ErrorManager::throwException(ErrorName::FileWriteFailed, fileName);
+		}
+		const auto start = index.size();
+		try {
+			putString(name);
+			put(static_cast<std::uint8_t>(kind));
+			const auto sizePosition = index.size();
+			put(std::uint64_t {0});
+			writeValue(value);
+			const std::uint64_t descriptionSize = index.size() - sizePosition - sizeof(std::uint64_t);
+			std::memcpy(index.data() + sizePosition, &descriptionSize, sizeof(descriptionSize));
+		} catch (...) {
+			// payloads already written stay in the file, but nothing refers to them
+			index.resize(start);
+			throw;
+		}
+	}
+
+	void Writer::writeValue(const Argument::TypedArgument& value) {
+		std::visit(
+			[this]<typename T>(const T& v) {
+				if constexpr (std::is_same_v<T, std::monostate>) {
+					ErrorManager::throwException(ErrorName::DLInvalidNodeType);
+				} else if constexpr (std::is_same_v<T, bool>) {
+					put(static_cast<std::uint8_t>(v ? 1 : 0));
+				} else if constexpr (std::is_same_v<T, mint> || std::is_same_v<T, double>) {
+					put(v);
+				} else if constexpr (std::is_same_v<T, std::complex<double>>) {
+					put(v.real());
+					put(v.imag());
+				} else if constexpr (std::is_same_v<T, std::string_view>) {
+					// the terminating null character follows the section, so that strings read from the file can be passed to LibraryLink directly
+					writeSection(bytesOf(v.data(), v.size()), NA::Codec::None);
+					if (!v.empty()) {
+						writeBytes("", 1);
+					}
+				} else {
+					writeValue(v);
+				}
+			},
+			value);
+	}
+
+	void Writer::writeValue(const GenericTensor& value) {
+		put(value.type());
+		putDimensions(value.getRank(), value.getDimensions());
+		writeSection(tensorBytes(value));
+	}
+
+	void Writer::writeValue(const GenericNumericArray& value) {
+		put(static_cast<std::uint32_t>(value.type()));
+		putDimensions(value.getRank(), value.getDimensions());
+		writeSection(bytesOf(value.rawData(), static_cast<std::size_t>(value.getFlattenedLength()) * elementSize(value.type())));
+	}
+
+	void Writer::writeValue(const GenericImage& value) {
+		put(value.is3D() ? value.slices() : mint {0});
+		put(value.columns());
+		put(value.rows());
+		put(value.channels());
+		put(static_cast<std::uint32_t>(value.type()));
+		put(static_cast<std::uint32_t>(value.colorspace()));
+		put(static_cast<std::uint8_t>(value.interleavedQ() ? 1 : 0));
+		writeSection(bytesOf(value.rawData(), static_cast<std::size_t>(value.getFlattenedLength()) * elementSize(imageElementType(value.type()))));
+	}
+
+	void Writer::writeValue(const GenericSparseArray& value) {
+		const auto rowPointers = value.getRowPointers();
+		const auto columnIndices = value.getColumnIndices();
+		const auto explicitValues = value.getExplicitValues();
+		const auto implicitValue = value.getImplicitValueAsTensor();
+		const auto nnz = explicitValues.getFlattenedLength();
+		put(value.type());
+		putDimensions(value.getRank(), value.getDimensions());
+		put(nnz);
+		// column indices of a vector are the positions of explicit values, otherwise there is one column index per dimension after the first
+		put(value.getRank() == 1 ? mint {1} : value.getRank() - 1);
+		put(rowPointers.getFlattenedLength());
+		writeSection(tensorBytes(rowPointers));
+		writeSection(tensorBytes(columnIndices));
+		writeSection(tensorBytes(explicitValues));
+		writeSection(tensorBytes(implicitValue));
+	}
+
+	void Writer::writeValue(const DataVector& value) {
+		const auto type = value.type();
+		const auto length = value.length();
+		put(static_cast<std::uint8_t>(type));
+		put(length);
+		if (value.missingCount() == 0) {
+			writeSection({});
+		} else {
+			const auto validity = value.validity();
+			writeSection(bytesOf(validity.data(), static_cast<std::size_t>(length)));
+		}
+		const auto data = value.viewData();
+		const auto writeNumeric = [&](const DV::NumericData& numeric) {
+			writeSection(bytesOf(numeric.raw_data, static_cast<std::size_t>(length) * elementSize(numeric.type)));
+		};
+		const auto writeOffsets = [&](std::span<mint> offsets) {
+			writeSection(bytesOf(offsets.data(), offsets.size_bytes()));
+			return static_cast<std::size_t>(offsets.back());
+		};
+		switch (type) {
+			case DV::Type::Numeric: {
+				const auto& numeric = std::get<DV::NumericData>(data);
+				put(static_cast<std::uint32_t>(numeric.type));
+				writeNumeric(numeric);
+				break;
+			}
+			case DV::Type::String: {
+				const auto& strings = std::get<DV::StringData>(data);
+				writeSection(bytesOf(strings.characters.data(), writeOffsets(strings.offsets)));
+				break;
+			}
+			case DV::Type::Boolean: {
+				const auto& booleans = std::get<Int8Array>(data);
+				writeSection(bytesOf(booleans.data(), static_cast<std::size_t>(length)));
+				break;
+			}
+			case DV::Type::Binary: {
+				const auto& binary = std::get<DV::BinaryData>(data);
+				writeSection(bytesOf(binary.array.data(), writeOffsets(binary.offsets)));
+				break;
+			}
+			case DV::Type::FixedWidthBinary: {
+				const auto& fixed = std::get<DV::FixedWidthBinaryData>(data);
+				put(fixed.width);
+				writeSection(bytesOf(fixed.array.data(), static_cast<std::size_t>(length * fixed.width)));
+				break;
+			}
+			case DV::Type::Date: {
+				const auto& date = std::get<DV::DateData>(data);
+				put(static_cast<std::uint32_t>(date.numeric_data.type));
+				put(date.granularity);
+				put(date.precision);
+				putString(date.time_zone);
+				writeNumeric(date.numeric_data);
+				break;
+			}
+			case DV::Type::Time: {
+				const auto& time = std::get<DV::TimeData>(data);
+				put(static_cast<std::uint32_t>(time.numeric_data.type));
+				put(time.granularity);
+				put(time.precision);
+				writeNumeric(time.numeric_data);
+				break;
+			}
+		}
+	}
+
+	void Writer::writeValue(const GenericDataList& value) {
+		put(value.length());
+		for (auto node : value) {
+			const auto nodeValue = node.value();
+			writeNode(node.name(), static_cast<MArgumentType>(nodeValue.index()), nodeValue);
+		}
+	}
+
+	void Writer::writeSection(std::span<const std::byte> payload) {
+		writeSection(payload, codec);
+	}
+
+	void Writer::writeSection(std::span<const std::byte> payload, NA::Codec sectionCodec) {
+		std::vector<std::uint8_t> compressed;
+		if (sectionCodec == NA::Codec::LZ4 && !payload.empty()) {
+			compressed = compressSection(payload, level);
+		}
+		// sections that do not get smaller are stored uncompressed, so that they can be mapped
+		if (compressed.empty() || compressed.size() >= payload.size()) {
+			sectionCodec = NA::Codec::None;
+		}
+		const auto stored = (sectionCodec == NA::Codec::None) ? payload : std::as_bytes(std::span {compressed});
+		std::uint64_t offset = 0;
+		if (!stored.empty()) {
+			static constexpr std::array<std::byte, PayloadAlignment> padding {};
+			writeBytes(padding.data(), (PayloadAlignment - position % PayloadAlignment) % PayloadAlignment);
+			offset = position;
+			writeBytes(stored.data(), stored.size());
+		}
+		put(offset);
+		put(static_cast<std::uint64_t>(stored.size()));
+		put(static_cast<std::uint8_t>(sectionCodec));
+		if (sectionCodec != NA::Codec::None) {
+			put(static_cast<std::uint64_t>(payload.size()));
+		}
+	}
+
+	void Writer::putBytes(const void* bytes, std::size_t count) {
+		index.append(static_cast<const char*>(bytes), count);
+	}
+
+	void Writer::putString(std::string_view s) {
+		put(static_cast<std::uint32_t>(s.size()));
+		putBytes(s.data(), s.size());
+		index.push_back('\0');
+	}
+
+	void Writer::putDimensions(mint rank, const mint* dims) {
+		put(rank);
+		putBytes(dims, static_cast<std::size_t>(rank) * sizeof(mint));
+	}
+
+	void Writer::writeBytes(const void* bytes, std::size_t count) {
+		if (count > 0 && std::fwrite(bytes, 1, count, file.get()) != count) {
+			ErrorManager::throwException(ErrorName::FileWriteFailed, fileName);
+		}
+		position += count;
+	}
+
+	/* Reader */
+
+	Reader::Reader(const std::string& fileName) : fileName {fileName}, file {fileName} {
+		const auto fileSize = file.size();
+		if (fileSize < sizeof(Header) + sizeof(Footer)) {
+			throwInvalid(fileName);
+		}
+		Header header {};
+		Footer footer {};
+		std::memcpy(&header, file.data(), sizeof(header));
+		std::memcpy(&footer, file.data() + fileSize - sizeof(footer), sizeof(footer));
+		if (header.magic != Magic || header.version != FormatVersion || header.byteOrderMark != ByteOrderMark || header.mintSize != sizeof(mint) ||
+			footer.magic != Magic || footer.indexOffset < sizeof(Header) || footer.indexOffset > fileSize - sizeof(footer) ||
+			footer.indexSize != fileSize - sizeof(footer) - footer.indexOffset) {
+			throwInvalid(fileName);
+		}
+		payloadSize = static_cast<std::size_t>(footer.indexOffset);
+		Cursor index {{file.data() + payloadSize, static_cast<std::size_t>(footer.indexSize)}, payloads(), this->fileName};
+		while (!index.atEnd()) {
+			Entry entry {};
+			entry.name = index.string();
+			entry.kind = static_cast<MArgumentType>(index.get<std::uint8_t>());
+			entry.description = index.take(static_cast<std::size_t>(index.get<std::uint64_t>()));
+			entries.push_back(entry);
+		}
+		if (entries.size() != footer.entryCount) {
+			throwInvalid(fileName);
+		}
+	}
+
+	std::vector<std::string_view> Reader::names() const {
+		std::vector<std::string_view> result;
+		result.reserve(entries.size());
+		std::transform(entries.begin(), entries.end(), std::back_inserter(result), [](const Entry& e) { return e.name; });
+		return result;
+	}
+
+	bool Reader::contains(std::string_view name) const noexcept {
+		return std::any_of(entries.begin(), entries.end(), [name](const Entry& e) { return e.name == name; });
+	}
+
+	MArgumentType Reader::type(std::string_view name) const {
+		return find(name).kind;
+	}
+
+	Argument::TypedArgument Reader::read(std::string_view name) const {
+		const auto& entry = find(name);
+		Cursor in {entry.description, payloads(), fileName};
+		return readValue(in, entry.kind);
+	}
+
+	GenericDataList Reader::readAll() const {
+		GenericDataList result;
+		for (const auto& entry : entries) {
+			Cursor in {entry.description, payloads(), fileName};
+			result.push_back(entry.name, readValue(in, entry.kind));
+		}
+		return result;
+	}
+
+	auto Reader::find(std::string_view name) const -> const Entry& {
+		auto it = std::find_if(entries.begin(), entries.end(), [name](const Entry& e) { return e.name == name; });
+		if (it == entries.end()) {
+			ErrorManager::throwException(ErrorName::SnapshotEntryNotFound, std::string {name});
+		}
+		return *it;
+	}
+
+	std::pair<MArrayDimensions, std::size_t> Reader::arrayLayout(std::string_view name, numericarray_data_t elementType) const {
+		const auto& entry = find(name);
+		Cursor in {entry.description, payloads(), fileName};
+		auto storedType = MNumericArray_Type_Undef;
+		std::vector<mint> dims;
+		switch (entry.kind) {
+			case MArgumentType::Tensor:
+				storedType = tensorElementType(in.get<mint>());
+				dims = in.dimensions();
+				break;
+			case MArgumentType::NumericArray:
+				storedType = static_cast<numericarray_data_t>(in.get<std::uint32_t>());
+				dims = in.dimensions();
+				break;
+			case MArgumentType::Image: {
+				std::array<mint, 4> sizes {};
+				for (auto& s : sizes) {
+					s = in.get<mint>();
+				}
+				storedType = imageElementType(static_cast<imagedata_t>(in.get<std::uint32_t>()));
+				in.get<std::uint32_t>();
+				in.get<std::uint8_t>();
+				dims = {std::max<mint>(sizes[0], 1) * sizes[1] * sizes[2] * sizes[3]};
+				break;
+			}
+			default: ErrorManager::throwException(ErrorName::SnapshotEntryType, std::string {name});
+		}
+		if (storedType != elementType) {
+			ErrorManager::throwException(ErrorName::SnapshotEntryType, std::string {name});
+		}
+		const auto section = in.location();
+		if (section.codec != NA::Codec::None) {
+			ErrorManager::throwException(ErrorName::SnapshotEntryCompressed, std::string {name});
+		}
+		if (section.size != byteCount(flatCount(dims, fileName), elementSize(storedType), fileName)) {
+			throwInvalid(fileName);
+		}
+		return {MArrayDimensions {dims}, section.size == 0 ? std::size_t {0} : static_cast<std::size_t>(section.offset)};
+	}
+
+}  // namespace LLU::Snapshot
@@ -0,0 +1,37 @@
+/**
+ * @file	UTFConversion.cpp
+ * @date	October 19, 2026
+ * @brief	Implementation of the non-template parts of UTF conversions.
+ */
+
+#include "LLU/UTFConversion.h"
+
+#include "LLU/ErrorLog/ErrorManager.h"
+
+namespace LLU {
+
+	namespace Detail {
+		void throwInvalidUTF(const char* encoding, std::size_t position) {
+			ErrorManager::throwException(ErrorName::InvalidUTFSequence, std::string {encoding}, static_cast<mint>(position));
+		}
+
+		void throwUTFBufferTooSmall(std::size_t size) {
+			ErrorManager::throwException(ErrorName::UTFBufferTooSmall, static_cast<mint>(size));
+		}
+	}  // namespace Detail
+
+	std::size_t utf16Length(std::string_view source) {
+		std::size_t length = 0;
+		Detail::forEachUTF8(
+			source, [&](std::string_view run) { length += run.size(); }, [&](char32_t codePoint) { length += codePoint > 0xFFFFU ? 2 : 1; });
+		return length;
+	}
+
+	std::size_t utf32Length(std::string_view source) {
+		std::size_t length = 0;
+		Detail::forEachUTF8(
+			source, [&](std::string_view run) { length += run.size(); }, [&](char32_t /*codePoint*/) { ++length; });
+		return length;
+	}
+
+}  // namespace LLU
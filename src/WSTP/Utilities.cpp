@@ -40,10 +40,8 @@ namespace LLU::WS {
 			}
 		}  // namespace
 
-		void checkError(WSLINK m, int statusOk, const std::string& errorName, const std::string& debugInfo) {
-			if (statusOk == 0) {
-				ErrorManager::throwExceptionWithDebugInfo(errorName, getWSErrorText(m) + "\nDebug info: " + debugInfo);
-			}
+		void throwWSTPError(WSLINK m, const std::string& errorName, const std::string& debugInfo) {
+			ErrorManager::throwExceptionWithDebugInfo(errorName, getWSErrorText(m) + "\nDebug info: " + debugInfo);
 		}
 
 		void throwLLUException(const std::string& errorName, const std::string& debugInfo) {
@@ -7,6 +7,7 @@
 
 #include <iostream>
 #include <list>
+#include <numeric>
 #include <string>
 
 #include "wstp.h"
@@ -454,4 +455,59 @@ LLU_LIBRARY_FUNCTION(FromInitList) {
 	res.push_back(DataList<LLU::NodeType::UTF8String> {{"a","x"sv},{"b","y"sv}});
 
 	mngr.set(res);
-}
\ No newline at end of file
+}
+LLU_LIBRARY_FUNCTION(IndexedLookup) {
+	auto dsIn = mngr.getDataList<LLU::NodeType::Any>(0);
+	auto key = mngr.getString(1);
+	auto pos = mngr.getInteger<mint>(2);
+
+	auto index = dsIn.index();
+	DataList<LLU::NodeType::Any> dsOut;
+	dsOut.push_back("Length", index.size());
+	dsOut.push_back("Position", index.position(key));
+	dsOut.push_back("ValueAtPosition", index.at(pos));
+	dsOut.push_back("NameAtPosition", index.name(pos));
+	if (auto node = index.find(key)) {
+		dsOut.push_back("ValueForKey", node.value());
+	}
+	mngr.set(dsOut);
+}
+
+LLU_LIBRARY_FUNCTION(IndexedSum) {
+	auto dsIn = mngr.getDataList<LLU::NodeType::Integer>(0);
+	auto index = dsIn.index();
+
+	mint sum = 0;
+	for (mint i = 0; i < index.size(); ++i) {
+		sum += index[i];
+	}
+	if (index.contains("weight")) {
+		sum *= index.as<mint>("weight");
+	}
+	mngr.set(sum);
+}
+
+LLU_LIBRARY_FUNCTION(FromRanges) {
+	auto n = mngr.getInteger<mint>(0);
+	std::vector<mint> ints(static_cast<std::size_t>(n));
+	std::iota(ints.begin(), ints.end(), 1);
+	std::vector<std::string> names;
+	std::transform(ints.cbegin(), ints.cend(), std::back_inserter(names), [](mint i) { return "k" + std::to_string(i); });
+
+	GenericDataList res;
+	res.push_back(DataList<LLU::NodeType::Integer> {ints});
+	res.push_back(DataList<LLU::NodeType::Real> {names, ints});
+	std::vector<LLU::NumericArray<std::int32_t>> arrays;
+	arrays.emplace_back(std::initializer_list<std::int32_t> {1, 2, 3});
+	arrays.emplace_back(std::initializer_list<std::int32_t> {4, 5});
+	res.push_back(DataList<LLU::GenericNumericArray> {arrays});
+	mngr.set(res);
+}
+
+LLU_LIBRARY_FUNCTION(AppendRangeMismatch) {
+	std::vector<std::string_view> names {"a", "b"};
+	std::vector<double> values {1.0, 2.0, 3.0};
+	DataList<LLU::NodeType::Real> dl;
+	dl.append_range(names, values);
+	mngr.set(dl);
+}
@@ -923,4 +923,195 @@ LLU_LIBRARY_FUNCTION(NewTimeDV) {
 	auto precision = mngr.getInteger<mint>(2);
 	auto dv = LLU::DataVector {data.clone(), granularity, precision};
 	mngr.set(dv);
-}
\ No newline at end of file
+}
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// DataVector builders tests
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Build numeric DataVector with every k-th element missing */
+LLU_LIBRARY_FUNCTION(BuildNumericDV) {
+	auto length = mngr.getInteger<mint>(0);
+	auto k = mngr.getInteger<mint>(1);
+	LLU::NumericColumnBuilder<double> builder {length / 2};	// deliberately too small to exercise buffer growth
+	for (mint i = 0; i < length; ++i) {
+		if (i % k == k - 1) {
+			builder.appendNull();
+		} else {
+			builder.append(static_cast<double>(i));
+		}
+	}
+	mngr.set(builder.finish());
+}
+
+/* Build string DataVector, empty strings become missing elements */
+LLU_LIBRARY_FUNCTION(BuildStringDV) {
+	auto strings = mngr.getDataList<LLU::NodeType::UTF8String>(0);
+	LLU::StringColumnBuilder builder;
+	for (auto str : strings.values()) {
+		if (str.empty()) {
+			builder.appendNull();
+		} else {
+			builder.append(str);
+		}
+	}
+	mngr.set(builder.finish());
+}
+
+/* Build boolean DataVector from a range of integers followed by a missing element */
+LLU_LIBRARY_FUNCTION(BuildBooleanDV) {
+	auto values = mngr.getTensor<mint>(0);
+	LLU::BooleanColumnBuilder builder;
+	builder.appendRange(values);
+	builder.appendNull();
+	mngr.set(builder.finish());
+}
+
+/* Build binary DataVector where the i-th byte array has i elements */
+LLU_LIBRARY_FUNCTION(BuildBinaryDV) {
+	auto length = mngr.getInteger<mint>(0);
+	LLU::BinaryColumnBuilder builder {length};
+	std::vector<std::uint8_t> bytes;
+	for (mint i = 0; i < length; ++i) {
+		builder.append(bytes);
+		bytes.push_back(static_cast<std::uint8_t>(i + 1));
+	}
+	mngr.set(builder.finish());
+}
+
+/* Build time DataVector from a NumericArray with a missing element appended */
+LLU_LIBRARY_FUNCTION(BuildTimeDV) {
+	auto data = mngr.getNumericArray<std::int64_t>(0);
+	LLU::TimeColumnBuilder<std::int64_t> builder {-40, -1};
+	builder.reserve(data.getFlattenedLength() + 1);
+	builder.appendRange(data);
+	builder.appendNull();
+	mngr.set(builder.finish());
+}
+
+/* Create string DataVector from a contiguous buffer of characters and a list of string lengths */
+LLU_LIBRARY_FUNCTION(NewStringDVFromBuffer) {
+	auto characters = mngr.getString(0);
+	auto lengths = mngr.getTensor<mint>(1);
+	auto ownedByLibraryLinkQ = mngr.getBoolean(2);
+	const auto lengths_span = std::span<mint> {lengths.begin(), lengths.end()};
+	LLU::BasicPool pool {4};
+	auto offsets = LLU::DV::lengthsToOffsets(lengths_span, pool, 4);
+	const auto str_count = static_cast<mint>(lengths_span.size());
+	if (ownedByLibraryLinkQ) {
+		auto buffer = LLU::makeUnique<char[]>(std::max(characters.size(), std::size_t {1}));
+		std::copy(characters.begin(), characters.end(), buffer.get());
+		mngr.set(LLU::DataVector {str_count, std::move(buffer), std::move(offsets)});
+	} else {
+		auto buffer = std::make_unique<char[]>(characters.size());
+		std::copy(characters.begin(), characters.end(), buffer.get());
+		mngr.set(LLU::DataVector {str_count, std::unique_ptr<const char[]> {buffer.release()}, std::move(offsets)});
+	}
+}
+
+/* Create string DataVector from a view of characters and offsets, without visiting individual strings */
+LLU_LIBRARY_FUNCTION(NewStringDVFromView) {
+	auto characters = mngr.getString(0);
+	auto offsets = mngr.getTensor<mint>(1);
+	mngr.set(LLU::DataVector {std::string_view {characters}, std::span<const mint> {offsets.begin(), offsets.end()}});
+}
+
+/* Compare sequential and parallel computation of offsets for n strings of pseudo-random lengths */
+LLU_LIBRARY_FUNCTION(ParallelOffsets) {
+	auto n = mngr.getInteger<mint>(0);
+	std::vector<std::int32_t> lengths(static_cast<std::size_t>(n));
+	for (std::size_t i = 0; i < lengths.size(); ++i) {
+		lengths[i] = static_cast<std::int32_t>((i * 7919) % 101);
+	}
+	const auto sequential = LLU::DV::lengthsToOffsets(std::span {lengths});
+	LLU::BasicPool pool {8};
+	const auto parallel = LLU::DV::lengthsToOffsets(std::span {lengths}, pool, 8);
+	mngr.set(std::equal(sequential.get(), sequential.get() + n + 1, parallel.get()));
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// DataVector kernels tests
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Take elements of a numeric DataVector greater than a given threshold */
+LLU_LIBRARY_FUNCTION(FilterGreater) {
+	auto dv = mngr.getDataVector(0);
+	auto threshold = mngr.getReal(1);
+	auto selection = LLU::DV::filter(dv, [threshold](auto v) { return static_cast<double>(v) > threshold; });
+	mngr.set(LLU::DV::take(dv, selection));
+}
+
+/* Take elements of any DataVector at given positions (1-based) */
+LLU_LIBRARY_FUNCTION(TakeRows) {
+	auto dv = mngr.getDataVector(0);
+	auto positions = mngr.getTensor<mint>(1);
+	std::vector<mint> indices(positions.begin(), positions.end());
+	std::for_each(indices.begin(), indices.end(), [](mint& i) { --i; });
+	mngr.set(LLU::DV::take(dv, indices));
+}
+
+/* Convert a numeric DataVector to Integer16 */
+LLU_LIBRARY_FUNCTION(CastToInteger16) {
+	auto dv = mngr.getDataVector(0);
+	mngr.set(LLU::DV::cast(dv, MNumericArray_Type_Bit16));
+}
+
+/* Return {count, sum, min, max} of a numeric DataVector */
+LLU_LIBRARY_FUNCTION(SummarizeDV) {
+	auto dv = mngr.getDataVector(0);
+	const auto summary = LLU::DV::summarize(dv);
+	mngr.set(LLU::Tensor<double> {static_cast<double>(summary.count), summary.sum, summary.min, summary.max});
+}
+
+/* Group values by keys and return the sum of values in each group */
+LLU_LIBRARY_FUNCTION(SumByKey) {
+	auto keys = mngr.getDataVector(0);
+	auto values = mngr.getDataVector(1);
+	const auto grouping = LLU::DV::groupBy(keys);
+	const auto summaries = LLU::DV::summarizeGroups(grouping, values);
+	LLU::Tensor<double> sums(0.0, {grouping.groupCount()});
+	std::transform(summaries.begin(), summaries.end(), sums.begin(), [](const auto& s) { return s.sum; });
+	mngr.set(sums);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Dictionary-encoded columns tests
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Encode a string DataVector and return the codes as a numeric DataVector */
+LLU_LIBRARY_FUNCTION(DictionaryCodes) {
+	auto dv = mngr.getDataVector(0);
+	auto encoded = LLU::DictionaryColumn<std::int16_t>::encode(dv);
+	mngr.set(encoded.codesColumn());
+}
+
+/* Encode a string DataVector and decode it back */
+LLU_LIBRARY_FUNCTION(DictionaryRoundTrip) {
+	auto dv = mngr.getDataVector(0);
+	auto encoded = LLU::DictionaryColumn<>::encode(dv);
+	mngr.set(encoded.decode());
+}
+
+/* Return the distinct values of a string DataVector in the order of first appearance */
+LLU_LIBRARY_FUNCTION(DictionaryValues) {
+	auto dv = mngr.getDataVector(0);
+	auto encoded = LLU::DictionaryColumn<>::encode(dv);
+	mngr.set(encoded.dictionaryColumn());
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// Validity bitmap tests
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/* Create numeric DataVector where Infinity and NaN are missing */
+LLU_LIBRARY_FUNCTION(NewNumericDVExceptionalMissing) {
+	auto num = mngr.getGenericNumericArray(0);
+	const auto validity = LLU::DV::exceptionalValuesAsMissing(num);
+	mngr.set(LLU::DataVector {LLU::DV::Type::Numeric, num.clone(), validity});
+}
+
+/* Return the number of missing elements in the conjunction and in the disjunction of validities of two DataVectors */
+LLU_LIBRARY_FUNCTION(CombinedMissingCounts) {
+	const auto lhs = mngr.getDataVector(0).validityBitmap();
+	const auto rhs = mngr.getDataVector(1).validityBitmap();
+	mngr.set(LLU::Tensor<mint> {(lhs & rhs).missingCount(), (lhs | rhs).missingCount()});
+}
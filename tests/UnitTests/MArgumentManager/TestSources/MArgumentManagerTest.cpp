@@ -3,8 +3,12 @@
  * @author	rafalc
  * @brief	Source code for unit tests of MArgumentManager
  */
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <functional>
 #include <iostream>
+#include <numeric>
 #include <tuple>
 
 #include <LLU/Containers/Iterators/DataList.hpp>
@@ -94,6 +98,32 @@ LLU_LIBRARY_FUNCTION(PredictChild) {
 	mngr.set(Person {personA.name + " Junior", 0, (personA.height + personB.height) / 2});
 }
 
+// A user-defined type with a non-throwing constructor from basic types, constructed in place when reading arguments
+struct Point2D {
+	Point2D(double x_, double y_) noexcept : x {x_}, y {y_} {}
+
+	double x;
+	double y;
+};
+
+namespace LLU {
+	template<>
+	struct MArgumentManager::CustomType<Point2D> { using CorrespondingTypes = std::tuple<double, double>; };
+}	 // namespace LLU
+
+// Area of a pentagon given by 5 vertices, each vertex is passed as 2 Real arguments
+LLU_LIBRARY_FUNCTION(PentagonArea) {
+	const auto vertices = std::apply([](auto... p) { return std::array<Point2D, 5> {p...}; },
+									 mngr.getTuple<Point2D, Point2D, Point2D, Point2D, Point2D>());
+	double area = 0.;
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		const auto& p = vertices[i];
+		const auto& q = vertices[(i + 1) % vertices.size()];
+		area += p.x * q.y - q.x * p.y;
+	}
+	mngr.set(std::abs(area) / 2);
+}
+
 // Fun with vectors - partial end explicit specializations of MArgumentManager::Getter (undocumented feature)
 namespace LLU {
 	template<typename T>
@@ -201,4 +231,51 @@ LIBRARIFY(repeatString)
 void doNothing() noexcept {}
 LIBRARIFY(doNothing)
 
-LIBRARIFY_TO(&Person::description, GetPersonDescription)
\ No newline at end of file
+LIBRARIFY_TO(&Person::description, GetPersonDescription)
+LLU_LISTABLE_TYPED_FUNCTION(TypedTransform, double(double, mint, double));
+double impl_TypedTransform(double a, mint n, double b) {
+	return a * static_cast<double>(n) + b;
+}
+
+LLU_LISTABLE_TYPED_FUNCTION(TypedIsDivisible, bool(mint, mint));
+bool impl_TypedIsDivisible(mint n, mint d) {
+	return d != 0 && n % d == 0;
+}
+
+LLU_TYPED_FUNCTION(TypedRepeatString, std::string(std::string_view, unsigned int));
+std::string impl_TypedRepeatString(std::string_view s, unsigned int n) {
+	return repeatString(std::string {s}, n);
+}
+
+LLU_TYPED_FUNCTION(TypedScale, LLU::Tensor<double>(const LLU::Tensor<double>&, double));
+LLU::Tensor<double> impl_TypedScale(const LLU::Tensor<double>& t, double factor) {
+	LLU::Tensor<double> result {0.0, LLU::MArrayDimensions {t.getDimensions(), t.getRank()}};
+	std::transform(t.cbegin(), t.cend(), result.begin(), [factor](double x) { return factor * x; });
+	return result;
+}
+
+LLU_TYPED_FUNCTION(TypedNumericArrayTotal, mint(const LLU::NumericArray<std::int32_t>&));
+mint impl_TypedNumericArrayTotal(const LLU::NumericArray<std::int32_t>& na) {
+	return std::accumulate(na.cbegin(), na.cend(), mint {0});
+}
+
+EXTERN_C DLLEXPORT int RawEmptyFunction(WolframLibraryData /*libData*/, mint /*Argc*/, MArgument* /*Args*/, MArgument /*Res*/) {
+	return LLU::ErrorCode::NoError;
+}
+
+LLU_LIBRARY_FUNCTION(EmptyFunction) {
+	LLU::Unused(mngr);
+}
+
+LLU_LIBRARY_FUNCTION(EmptyFunctionWithArgs) {
+	mngr.set(mngr.get<mint>(0) + mngr.get<mint>(1));
+}
+
+LLU_LIBRARY_FUNCTION(JoinStrings) {
+	std::string result;
+	for (size_t i = 0; i < 12; ++i) {
+		result += mngr.getCString(i);
+		result += mngr.getString(i);
+	}
+	mngr.set(result);
+}
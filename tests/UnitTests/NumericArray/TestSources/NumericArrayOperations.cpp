@@ -164,6 +164,14 @@ LLU_LIBRARY_FUNCTION(accumulateIntegers) {
 	mngr.operateOnNumericArray<LLU::Passing::Constant, AccumulateIntegers>(0, mngr);
 }
 
+// same as accumulateIntegers but the operation is instantiated only for integer types
+LLU_LIBRARY_FUNCTION(sumIntegers) {
+	auto result = mngr.operateOnNumericArray<LLU::IntegerTypes, LLU::Passing::Constant>(0, [](const auto& na) {
+		return std::accumulate(na.begin(), na.end(), mint {0}, [](mint acc, auto v) { return acc + static_cast<mint>(v); });
+	});
+	mngr.setInteger(result);
+}
+
 // check if conversion methods are mapped correctly
 LLU_LIBRARY_FUNCTION(convertMethodName) {
 	auto method = mngr.getInteger<NA::ConversionMethod>(0);
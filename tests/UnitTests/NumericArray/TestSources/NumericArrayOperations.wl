@@ -15,6 +15,7 @@ cloneNA = `LLU`PacletFunctionLoad["cloneNumericArrays", {{NumericArray, "Constan
 changeSharedNA = `LLU`PacletFunctionLoad["changeSharedNumericArray", {{NumericArray, "Shared"}}, Integer];
 getSharedNA = `LLU`PacletFunctionLoad["getSharedNumericArray", {}, NumericArray];
 accumulateIntegers = `LLU`PacletFunctionLoad["accumulateIntegers", {{NumericArray, "Constant"}}, Integer];
+sumIntegers = `LLU`PacletFunctionLoad["sumIntegers", {{NumericArray, "Constant"}}, Integer];
 convertMethodName = `LLU`PacletFunctionLoad["convertMethodName", {Integer}, String];
 convert = `LLU`PacletFunctionLoad["convert", {{NumericArray, "Constant"}, Integer, Real}, NumericArray];
 convertGeneric = `LLU`PacletFunctionLoad["convertGeneric", {{NumericArray, "Constant"}, Integer, Real}, NumericArray];
@@ -3,8 +3,11 @@
  * @brief
  */
 
+#include <algorithm>
 #include <cctype>
+#include <cstddef>
 #include <string>
+#include <string_view>
 
 #include <LLU/LLU.h>
 #include <LLU/LibraryLinkFunctionMacro.h>
@@ -60,4 +63,45 @@ EXTERN_C DLLEXPORT int StringLength(WolframLibraryData libData, mint Argc, MArgu
 	auto name = mngr.getString(0);
 	mngr.setInteger(name.length());
 	return LIBRARY_NO_ERROR;
-}
\ No newline at end of file
+}
+
+LIBRARY_LINK_FUNCTION(TrimView) {
+	LLU::MArgumentManager mngr(libData, Argc, Args, Res);
+
+	std::string_view in = mngr.getCString(0);
+	auto first = in.find_first_not_of(' ');
+	if (first == std::string_view::npos) {
+		mngr.set(std::string_view {});
+		return LIBRARY_NO_ERROR;
+	}
+	mngr.set(in.substr(first, in.find_last_not_of(' ') - first + 1));
+	return LIBRARY_NO_ERROR;
+}
+
+LIBRARY_LINK_FUNCTION(CountLines) {
+	LLU::MArgumentManager mngr(libData, Argc, Args, Res);
+
+	auto text = mngr.getStringView(0);
+	mngr.setInteger(text.empty() ? 0 : std::count(text.begin(), text.end(), '\n') + (text.back() == '\n' ? 0 : 1));
+	return LIBRARY_NO_ERROR;
+}
+
+LIBRARY_LINK_FUNCTION(ByteSum) {
+	LLU::MArgumentManager mngr(libData, Argc, Args, Res);
+
+	mint sum = 0;
+	for (auto b : mngr.getBytes(0)) {
+		sum += std::to_integer<mint>(b);
+	}
+	mngr.setInteger(sum);
+	return LIBRARY_NO_ERROR;
+}
+
+LIBRARY_LINK_FUNCTION(CommonPrefixLength) {
+	LLU::MArgumentManager mngr(libData, Argc, Args, Res);
+
+	auto [a, b] = mngr.getTuple<std::string_view, std::string_view>();
+	auto mismatch = std::mismatch(a.begin(), a.end(), b.begin(), b.end());
+	mngr.setInteger(mismatch.first - a.begin());
+	return LIBRARY_NO_ERROR;
+}
@@ -4,6 +4,7 @@
  */
 
 #include <fstream>
+#include <numeric>
 
 #include <LLU/LLU.h>
 #include <LLU/LibraryLinkFunctionMacro.h>
@@ -171,3 +172,142 @@ LLU_LIBRARY_FUNCTION(UTF32BytesToUTF8) {
 	std::string u8str = LLU::fromUTF32toUTF8(u32str);
 	mngr.set(u8str);
 }
+
+LLU_LIBRARY_FUNCTION(MappedSum) {
+	auto filePath = mngr.getString(0);
+	LLU::MappedArray<double> values {filePath};
+	values.advise(LLU::MappedAccess::Sequential);
+	mngr.set(std::accumulate(values.cbegin(), values.cend(), 0.0));
+}
+
+LLU_LIBRARY_FUNCTION(MappedMatrix) {
+	auto filePath = mngr.getString(0);
+	auto offset = mngr.getInteger<std::size_t>(1);
+	auto rows = mngr.getInteger<mint>(2);
+	auto columns = mngr.getInteger<mint>(3);
+	LLU::MappedArray<std::int32_t> matrix {filePath, LLU::MArrayDimensions {rows, columns}, offset};
+	mngr.set(matrix.toNumericArray());
+}
+
+LLU_LIBRARY_FUNCTION(ChunkedSum) {
+	auto filePath = mngr.getString(0);
+	auto elementsPerChunk = mngr.getInteger<mint>(1);
+	LLU::NumericArrayChunkReader<double> reader {filePath, elementsPerChunk};
+	double sum = 0.0;
+	mint chunks = 0;
+	reader.forEachChunk([&](const LLU::NumericArray<double>& chunk) {
+		sum += std::accumulate(chunk.begin(), chunk.end(), 0.0);
+		++chunks;
+	});
+	mngr.set(LLU::Tensor<double> {sum, static_cast<double>(chunks)});
+}
+
+LLU_LIBRARY_FUNCTION(ChunkedDelimitedCounts) {
+	auto filePath = mngr.getString(0);
+	auto chunkSize = mngr.getInteger<std::size_t>(1);
+	LLU::DelimitedChunkReader reader {filePath, '\t', chunkSize};
+	mint rows = 0;
+	mint missing = 0;
+	reader.forEachChunk([&](std::vector<LLU::DataVector>& columns) {
+		rows += columns.front().length();
+		for (const auto& c : columns) {
+			missing += c.missingCount();
+		}
+	});
+	mngr.set(LLU::Tensor<mint> {static_cast<mint>(reader.columnCount()), rows, missing});
+}
+
+namespace {
+	/// Type, length and number of missing values of each column
+	LLU::Tensor<mint> columnInfo(const LLU::CSV::Table& table) {
+		LLU::Tensor<mint> info(0, {3, static_cast<mint>(table.columns.size())});
+		for (std::size_t c = 0; c < table.columns.size(); ++c) {
+			const auto i = static_cast<mint>(c);
+			info[{0, i}] = static_cast<mint>(table.types[c]);
+			info[{1, i}] = table.columns[c].length();
+			info[{2, i}] = table.columns[c].missingCount();
+		}
+		return info;
+	}
+}  // namespace
+
+LLU_LIBRARY_FUNCTION(CSVColumnInfo) {
+	auto filePath = mngr.getString(0);
+	auto threadCount = mngr.getInteger<unsigned>(1);
+	mngr.set(columnInfo(LLU::CSV::read(filePath, {.threadCount = threadCount})));
+}
+
+LLU_LIBRARY_FUNCTION(CSVTextColumnInfo) {
+	mngr.set(columnInfo(LLU::CSV::parse(mngr.getString(0))));
+}
+
+LLU_LIBRARY_FUNCTION(CSVNames) {
+	auto table = LLU::CSV::parse(mngr.getString(0));
+	mngr.set(std::accumulate(table.names.cbegin(), table.names.cend(), std::string {}, [](std::string acc, const std::string& name) {
+		return acc.empty() ? name : std::move(acc) + "|" + name;
+	}));
+}
+
+LLU_LIBRARY_FUNCTION(AsyncWriteReadSum) {
+	auto filePath = mngr.getString(0);
+	auto blockCount = mngr.getInteger<mint>(1);
+	auto blockLength = mngr.getInteger<mint>(2);
+	auto backend = static_cast<LLU::AsyncBackend>(mngr.getInteger<int>(3));
+	const auto blockBytes = static_cast<std::uint64_t>(blockLength) * sizeof(double);
+	std::vector<LLU::NumericArray<double>> blocks;
+	blocks.reserve(static_cast<std::size_t>(blockCount));
+	{
+		LLU::AsyncFile file {filePath, std::ios::out | std::ios::trunc, LLU::AsyncFile::DefaultQueueDepth, backend};
+		for (mint i = 0; i < blockCount; ++i) {
+			auto& block = blocks.emplace_back(0.0, LLU::MArrayDimensions {blockLength});
+			std::iota(block.begin(), block.end(), static_cast<double>(i * blockLength));
+			file.writeAt(static_cast<std::uint64_t>(i) * blockBytes, block);
+		}
+		file.wait();
+	}
+	LLU::AsyncFile file {filePath, std::ios::in, LLU::AsyncFile::DefaultQueueDepth, backend};
+	double sum = 0.0;
+	mint completions = 0;
+	// read the blocks in reverse order, each completion sums its own block
+	for (mint i = blockCount - 1; i >= 0; --i) {
+		auto& block = blocks[static_cast<std::size_t>(i)];
+		std::fill(block.begin(), block.end(), 0.0);
+		file.readAt(static_cast<std::uint64_t>(i) * blockBytes, block, [&, i](std::size_t bytes) {
+			const auto& b = blocks[static_cast<std::size_t>(i)];
+			sum += std::accumulate(b.begin(), b.end(), 0.0);
+			completions += (bytes == blockBytes) ? 1 : 0;
+		});
+	}
+	file.wait();
+	mngr.set(LLU::Tensor<double> {sum, static_cast<double>(completions)});
+}
+
+LLU_LIBRARY_FUNCTION(SnapshotRoundTrip) {
+	auto filePath = mngr.getString(0);
+	{
+		LLU::Snapshot::Writer writer {filePath, static_cast<LLU::NA::Codec>(mngr.getInteger<std::uint8_t>(2))};
+		writer.addAll(mngr.getGenericDataList(1));
+		writer.finish();
+	}
+	LLU::Snapshot::Reader reader {filePath};
+	mngr.set(reader.readAll());
+}
+
+LLU_LIBRARY_FUNCTION(SnapshotMappedTotal) {
+	LLU::Snapshot::Reader reader {mngr.getString(0)};
+	auto values = reader.map<double>(mngr.getString(1));
+	mngr.set(std::accumulate(values.cbegin(), values.cend(), 0.0));
+}
+
+LLU_LIBRARY_FUNCTION(CompressNumericArray) {
+	auto array = mngr.getGenericNumericArray<LLU::Passing::Constant>(0);
+	LLU::NA::CompressionOptions options;
+	options.level = mngr.getInteger<int>(1);
+	options.blockSize = mngr.getInteger<std::size_t>(2);
+	mngr.set(LLU::NA::compress(array, options));
+}
+
+LLU_LIBRARY_FUNCTION(DecompressNumericArray) {
+	auto data = mngr.getNumericArray<std::uint8_t, LLU::Passing::Constant>(0);
+	mngr.set(LLU::NA::decompress({data.data(), static_cast<std::size_t>(data.size())}));
+}
@@ -8,14 +8,19 @@
 #include <LLU/NoMinMaxWindows.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <random>
 #include <regex>
 #include <set>
 #include <string>
 #include <vector>
 
+#include <LLU/Containers/Image.h>
+#include <LLU/Containers/NumericArray.h>
+#include <LLU/Containers/Tensor.h>
 #include <LLU/LibraryData.h>
 #include <LLU/ErrorLog/LibraryLinkError.h>
 #include <LLU/LibraryLinkFunctionMacro.h>
@@ -25,6 +30,11 @@ namespace WS = LLU::WS;
 using LLU::WSStream;
 using WSTPStream = WSStream<WS::Encoding::UTF8>;
 
+EXTERN_C DLLEXPORT int WolframLibrary_initialize(WolframLibraryData libData) {
+	LLU::LibraryData::setLibraryData(libData);
+	return 0;
+}
+
 template<typename T>
 void readAndWriteScalar(WSTPStream& m) {
 	T x;
@@ -531,6 +541,24 @@ LLU_WSTP_FUNCTION(Empty) {
 	ml << WS::EndExpr();
 }
 
+// Arguments of expressions started with BeginExpr are counted while they are being sent, so mix different kinds of nested arguments
+LLU_WSTP_FUNCTION(NestedUnknownLength) {
+	WSTPStream ml(wsl, 1);
+
+	int n {};
+	ml >> n;
+
+	ml << WS::BeginExpr("List");
+	for (int i = 0; i < n; ++i) {
+		ml << WS::BeginExpr("Point") << i << WS::Rule << "x" << 0.5 << WS::Missing("m") << WS::EndExpr();
+	}
+	ml << std::vector<int> {1, 2, 3} << std::map<std::string, int> {{"a", 1}};
+	ml << WS::BeginExpr("Wrapper");
+	WSPutSymbol(ml.get(), "Null");	  // expressions sent directly to the link must be counted in EndExpr
+	ml << true << WS::EndExpr();
+	ml << WS::EndExpr();
+}
+
 LLU_WSTP_FUNCTION(ListOfStringsTiming) {
 
 	WSTPStream ml(wsl, 2);
@@ -556,3 +584,67 @@ LLU_WSTP_FUNCTION(ListOfStringsTiming) {
 
 	ml << WS::EndPacket;
 }
+
+// Send a list of n points, each point is a small expression made of 2 functions and 2 reals
+LLU_WSTP_FUNCTION(ListOfPoints) {
+	WSTPStream ml(wsl, 1);
+
+	int n {};
+	ml >> n;
+
+	ml << WS::List(n);
+	for (int i = 0; i < n; ++i) {
+		ml << WS::Function("Point", 1) << WS::List(2) << static_cast<double>(i) << static_cast<double>(-i);
+	}
+	ml << WS::EndPacket;
+}
+
+// Debug info of WSTP errors is only built when a WSTP call fails, so check that it is still there
+LLU_WSTP_FUNCTION(WrongHeadDebugInfo) {
+	std::string debugInfo;
+	try {
+		WSTPStream ml(wsl, "Point", 2);
+	} catch (const LLU::LibraryLinkError& e) {
+		debugInfo = e.debug();
+	}
+	WSTPStream ml(wsl);
+	ml << WS::NewPacket << debugInfo << WS::EndPacket;
+}
+
+//
+// LLU containers
+//
+
+LLU_WSTP_FUNCTION(ScaleTensor) {
+	WSTPStream ml(wsl, 2);
+
+	LLU::Tensor<double> t;
+	double factor {};
+	ml >> t >> factor;
+
+	std::transform(t.begin(), t.end(), t.begin(), [factor](double x) { return factor * x; });
+	ml << t;
+}
+
+// uint16_t is not supported by WSTP so the data is transferred as int
+LLU_WSTP_FUNCTION(ReverseNumericArray) {
+	WSTPStream ml(wsl, 1);
+
+	LLU::NumericArray<std::uint16_t> na;
+	ml >> na;
+
+	std::reverse(na.begin(), na.end());
+	ml << na;
+}
+
+LLU_WSTP_FUNCTION(ImagePixels) {
+	WSTPStream ml(wsl, 2);
+
+	mint width {};
+	mint height {};
+	ml >> width >> height;
+
+	LLU::Image<std::uint8_t> im {width, height, 1, MImage_CS_Gray, false};
+	std::iota(im.begin(), im.end(), std::uint8_t {0});
+	ml << im;
+}